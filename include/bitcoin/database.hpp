@@ -73,15 +73,22 @@
 #include <bitcoin/database/tables/indexes/height.hpp>
 #include <bitcoin/database/tables/indexes/strong_tx.hpp>
 #include <bitcoin/database/tables/optionals/address.hpp>
+#include <bitcoin/database/tables/optionals/fee_bk.hpp>
 #include <bitcoin/database/tables/optionals/filter_bk.hpp>
 #include <bitcoin/database/tables/optionals/filter_tx.hpp>
+#include <bitcoin/database/tables/optionals/pool.hpp>
 #include <bitcoin/database/types/fee_rate.hpp>
+#include <bitcoin/database/types/hash_bloom.hpp>
+#include <bitcoin/database/types/header_entry.hpp>
 #include <bitcoin/database/types/header_state.hpp>
 #include <bitcoin/database/types/history.hpp>
 #include <bitcoin/database/types/position.hpp>
+#include <bitcoin/database/types/short_ids.hpp>
 #include <bitcoin/database/types/span.hpp>
 #include <bitcoin/database/types/type.hpp>
 #include <bitcoin/database/types/types.hpp>
 #include <bitcoin/database/types/unspent.hpp>
+#include <bitcoin/database/types/wire_cache.hpp>
+#include <bitcoin/database/types/wire_segments.hpp>
 
 #endif
@@ -66,6 +66,7 @@ enum error_t : uint8_t
     mremap_failure,
     munmap_failure,
     madvise_failure,
+    mlock_failure,
     sysconf_failure,
     ftruncate_failure,
     fsync_failure,
@@ -87,6 +88,8 @@ enum error_t : uint8_t
     not_coalesced,
     missing_snapshot,
     unloaded_file,
+    read_only_store,
+    pending_prune,
 
     /// tables
     create_table,
@@ -95,6 +98,9 @@ enum error_t : uint8_t
     backup_table,
     restore_table,
     verify_table,
+    migrate_table,
+    follow_table,
+    publish_table,
 
     /// validation/confirmation
     tx_connected,
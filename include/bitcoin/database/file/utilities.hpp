@@ -53,6 +53,11 @@ BCD_API bool create_file(const path& to, const uint8_t* data,
 BCD_API code create_file_ex(const path& to, const uint8_t* data,
     size_t size) NOEXCEPT;
 
+/// Open existing file and read exactly size bytes into data.
+BCD_API bool read_file(uint8_t* data, size_t size, const path& from) NOEXCEPT;
+BCD_API code read_file_ex(uint8_t* data, size_t size,
+    const path& from) NOEXCEPT;
+
 /// Delete file or empty directory, false on error only.
 BCD_API bool remove(const path& name) NOEXCEPT;
 BCD_API code remove_ex(const path& name) NOEXCEPT;
@@ -71,9 +76,11 @@ BCD_API bool copy_directory(const path& from, const path& to) NOEXCEPT;
 BCD_API code copy_directory_ex(const path& from, const path& to) NOEXCEPT;
 
 /// File descriptor functions (for memory mapping).
-BCD_API int open(const path& filename, bool random=true) NOEXCEPT;
+/// Read-only (!write) open is shared and does not take the write lock.
+BCD_API int open(const path& filename, bool random=true,
+    bool write=true) NOEXCEPT;
 BCD_API code open_ex(int& file_descriptor, const path& filename,
-    bool random=true) NOEXCEPT;
+    bool random=true, bool write=true) NOEXCEPT;
 BCD_API bool close(int file_descriptor) NOEXCEPT;
 BCD_API code close_ex(int file_descriptor) NOEXCEPT;
 BCD_API bool size(size_t& out, int file_descriptor) NOEXCEPT;
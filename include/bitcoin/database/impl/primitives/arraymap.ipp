@@ -82,6 +82,17 @@ bool CLASS::verify() const NOEXCEPT
         (count == body_.count());
 }
 
+TEMPLATE
+bool CLASS::follow() NOEXCEPT
+{
+    Link count{};
+    if (!head_.get_body_count(count))
+        return false;
+
+    return count < body_.count() ? body_.truncate(count) :
+        body_.expand(count);
+}
+
 // sizing
 // ----------------------------------------------------------------------------
 
@@ -186,6 +197,42 @@ inline bool CLASS::get(const Link& link, Element& element) const NOEXCEPT
     return element.from_data(source);
 }
 
+TEMPLATE
+inline memory_ptr CLASS::get_memory() const NOEXCEPT
+{
+    return body_.get();
+}
+
+// static
+TEMPLATE
+ELEMENT_CONSTRAINT
+bool CLASS::get(const memory_ptr& ptr, const Link& link,
+    Element& element) NOEXCEPT
+{
+    using namespace system;
+    if (!ptr || link.is_terminal())
+        return false;
+
+    const auto start = body::link_to_position(link);
+    if (is_limited<ptrdiff_t>(start))
+        return false;
+
+    const auto size = ptr->size();
+    const auto position = possible_narrow_and_sign_cast<ptrdiff_t>(start);
+    if (position >= size)
+        return false;
+
+    const auto offset = ptr->offset(start);
+    if (is_null(offset))
+        return false;
+
+    iostream stream{ offset, size - position };
+    reader source{ stream };
+
+    if constexpr (!is_slab) { BC_DEBUG_ONLY(source.set_limit(RowSize * element.count());) }
+    return element.from_data(source);
+}
+
 TEMPLATE
 ELEMENT_CONSTRAINT
 bool CLASS::put(size_t key, const Element& element) NOEXCEPT
@@ -111,6 +111,86 @@ bool CLASS::set_body_count(const Link& count) NOEXCEPT
     return true;
 }
 
+TEMPLATE
+bool CLASS::is_sized(size_t cell) const NOEXCEPT
+{
+    using namespace system;
+    const auto cells = add1<size_t>(buckets_);
+    return !is_multiply_overflow(cells, cell) &&
+        file_.size() == cells * cell;
+}
+
+TEMPLATE
+bool CLASS::migrate(Link& count, size_t cell) NOEXCEPT
+{
+    // An interrupted migration is restarted, with its body count unknown.
+    if (is_migrating())
+    {
+        count = Link::terminal;
+    }
+
+    // Body count is the first value in link size, independent of cell size.
+    else if (cell == cell_size || !is_sized(cell) || !get_body_count(count))
+    {
+        return false;
+    }
+
+    // Head is recreated in place, cells are repopulated by the caller. The
+    // terminal body count marks the head as migrating until it is replaced.
+    return reset() && set_body_count(Link::terminal);
+}
+
+TEMPLATE
+bool CLASS::is_migrating() const NOEXCEPT
+{
+    Link count{};
+    return is_sized(cell_size) && get_body_count(count) &&
+        count.is_terminal();
+}
+
+TEMPLATE
+bool CLASS::reset() NOEXCEPT
+{
+    return file_.truncate(zero) && create();
+}
+
+TEMPLATE
+void CLASS::sample_filter(size_t& rejects, size_t& probes,
+    size_t samples) const NOEXCEPT
+{
+    using namespace system;
+    constexpr size_t probes_per_bucket = 8;
+    rejects = zero;
+    probes = zero;
+
+    if constexpr (!filter_t::disabled)
+    {
+        if (is_zero(samples) || is_zero(buckets_.value))
+            return;
+
+        const auto step = std::max(one, buckets_.value / samples);
+        for (size_t bucket{}; bucket < buckets_.value; bucket += step)
+        {
+            const auto value = get_cell(possible_narrow_cast<link>(bucket));
+            if (to_link(value) == Link::terminal)
+                continue;
+
+            for (size_t probe{}; probe < probes_per_bucket; ++probe)
+            {
+                // splitmix64 finalizer over bucket/probe ordinal.
+                uint64_t entropy = bucket * probes_per_bucket + probe;
+                entropy = (entropy ^ (entropy >> 30)) * 0xbf58476d1ce4e5b9_u64;
+                entropy = (entropy ^ (entropy >> 27)) * 0x94d049bb133111eb_u64;
+                entropy = (entropy ^ (entropy >> 31));
+
+                ++probes;
+                if (!screened(value, entropy))
+                    ++rejects;
+            }
+        }
+    }
+}
+
 // operation
 // ----------------------------------------------------------------------------
 
@@ -71,6 +71,57 @@ bool CLASS::verify() const NOEXCEPT
         (count == body_.count());
 }
 
+TEMPLATE
+bool CLASS::follow() NOEXCEPT
+{
+    Link count{};
+    if (!head_.get_body_count(count))
+        return false;
+
+    return count < body_.count() ? body_.truncate(count) :
+        body_.expand(count);
+}
+
+TEMPLATE
+bool CLASS::is_legacy(size_t cell) const NOEXCEPT
+{
+    return cell != CellSize && (head_.is_sized(cell) || head_.is_migrating());
+}
+
+TEMPLATE
+bool CLASS::migrate(size_t cell) NOEXCEPT
+{
+    if constexpr (is_slab)
+    {
+        return false;
+    }
+    else
+    {
+        // Head body count is terminal until all records are indexed, so an
+        // interrupted migration does not verify but remains legacy (resumes).
+        Link count{};
+        if (!head_.migrate(count, cell))
+            return false;
+
+        // Records are reindexed in order, reproducing each conflict list.
+        // A resumed migration obtains terminal count, so indexes full body.
+        const auto ptr = get_memory();
+        const Link end{ std::min(count.value, body_.count().value) };
+        for (Link link{ 0 }; link.value < end.value; ++link)
+            if (!commit(ptr, link, get_key(ptr, link)))
+                return false;
+
+        return head_.set_body_count(end);
+    }
+}
+
+TEMPLATE
+bool CLASS::reset() NOEXCEPT
+{
+    // Head is emptied first, so no search reaches truncated body.
+    return head_.reset() && body_.truncate(Link{ 0 });
+}
+
 // sizing
 // ----------------------------------------------------------------------------
 
@@ -131,6 +182,13 @@ size_t CLASS::negative_search_count() const NOEXCEPT
     return negative_.load(std::memory_order_relaxed);
 }
 
+TEMPLATE
+void CLASS::sample_filter(size_t& rejects, size_t& probes,
+    size_t samples) const NOEXCEPT
+{
+    head_.sample_filter(rejects, probes, samples);
+}
+
 // query interface
 // ----------------------------------------------------------------------------
 
@@ -225,6 +283,31 @@ Key CLASS::get_key(const Link& link) NOEXCEPT
         Link::size));
 }
 
+// static
+TEMPLATE
+Key CLASS::get_key(const memory_ptr& ptr, const Link& link) NOEXCEPT
+{
+    using namespace system;
+    if (!ptr || link.is_terminal())
+        return {};
+
+    const auto start = body::link_to_position(link);
+    if (is_limited<ptrdiff_t>(start) || is_add_overflow(start, index_size))
+        return {};
+
+    const auto position = possible_narrow_and_sign_cast<ptrdiff_t>(start);
+    const auto end = possible_narrow_and_sign_cast<ptrdiff_t>(start +
+        index_size);
+    if (position >= ptr->size() || end > ptr->size())
+        return {};
+
+    const auto offset = ptr->offset(start);
+    if (is_null(offset))
+        return {};
+
+    return unsafe_array_cast<uint8_t, key_size>(std::next(offset, Link::size));
+}
+
 TEMPLATE
 ELEMENT_CONSTRAINT
 inline bool CLASS::find(const Key& key, Element& element) const NOEXCEPT
@@ -30,6 +30,12 @@ CLASS::nomap(storage& header, storage& body) NOEXCEPT
 {
 }
 
+TEMPLATE
+CLASS::nomap(storage& header, storage& body, const Link& buckets) NOEXCEPT
+  : head_(header, buckets), manager_(body)
+{
+}
+
 // not thread safe
 // ----------------------------------------------------------------------------
 
@@ -69,6 +75,17 @@ bool CLASS::verify() const NOEXCEPT
         head_.get_body_count(count) && count == manager_.count();
 }
 
+TEMPLATE
+bool CLASS::follow() NOEXCEPT
+{
+    Link count{};
+    if (!head_.get_body_count(count))
+        return false;
+
+    return count < manager_.count() ? manager_.truncate(count) :
+        manager_.expand(count);
+}
+
 // sizing
 // ----------------------------------------------------------------------------
 
@@ -138,6 +155,18 @@ code CLASS::reload() NOEXCEPT
 // query interface
 // ----------------------------------------------------------------------------
 
+TEMPLATE
+inline Link CLASS::at(size_t index) const NOEXCEPT
+{
+    return head_.at(index);
+}
+
+TEMPLATE
+inline bool CLASS::push(const Link& value, size_t index) NOEXCEPT
+{
+    return head_.push(value, head_.index(index));
+}
+
 TEMPLATE
 inline bool CLASS::reserve(const Link& size) NOEXCEPT
 {
@@ -145,6 +174,12 @@ inline bool CLASS::reserve(const Link& size) NOEXCEPT
     return manager_.reserve(size);
 }
 
+TEMPLATE
+inline Link CLASS::allocate(const Link& size) NOEXCEPT
+{
+    return manager_.allocate(size);
+}
+
 TEMPLATE
 inline memory_ptr CLASS::get_memory() const NOEXCEPT
 {
@@ -220,6 +255,36 @@ bool CLASS::put(const memory_ptr& ptr, const Element& element) NOEXCEPT
     return element.to_data(sink);
 }
 
+// static
+TEMPLATE
+template <typename Element, if_equal<Element::size, Size>>
+bool CLASS::put(const memory_ptr& ptr, const Link& link,
+    const Element& element) NOEXCEPT
+{
+    using namespace system;
+    if (!ptr || link.is_terminal())
+        return false;
+
+    const auto start = manager::link_to_position(link);
+    if (is_limited<ptrdiff_t>(start))
+        return false;
+
+    const auto size = ptr->size();
+    const auto position = possible_narrow_and_sign_cast<ptrdiff_t>(start);
+    if (position >= size)
+        return false;
+
+    const auto offset = ptr->offset(start);
+    if (is_null(offset))
+        return false;
+
+    iostream stream{ offset, size - position };
+    flipper sink{ stream };
+
+    if constexpr (!is_slab) { BC_DEBUG_ONLY(sink.set_limit(Size * element.count());) }
+    return element.to_data(sink);
+}
+
 TEMPLATE
 template <typename Element, if_equal<Element::size, Size>>
 inline bool CLASS::put_link(Link& link, const Element& element) NOEXCEPT
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_DATABASE_QUERY_ARCHIVE_CHAIN_READER_IPP
 
 #include <algorithm>
+#include <atomic>
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
@@ -74,20 +75,35 @@ typename CLASS::outputs_ptr CLASS::get_outputs(
 
 TEMPLATE
 typename CLASS::transactions_ptr CLASS::get_transactions(
-    const header_link& link, bool witness) const NOEXCEPT
+    const header_link& link, bool witness, bool turbo) const NOEXCEPT
 {
-    // TODO: eliminate shared memory pointer reallocations.
     using namespace system;
     const auto txs = to_transactions(link);
     if (txs.empty())
         return {};
 
-    const auto transactions = to_shared<chain::transaction_cptrs>();
-    transactions->reserve(txs.size());
+    // Txs are independent, so reconstruction fans out across them (turbo).
+    // Each tx is constructed directly into its position (no reallocation).
+    stopper fail{};
+    constexpr auto relaxed = std::memory_order_relaxed;
+    const auto policy = poolstl::execution::par_if(turbo);
+    const auto transactions = to_shared<chain::transaction_cptrs>(txs.size());
 
-    for (const auto& tx_fk: txs)
-        if (!push_bool(*transactions, get_transaction(tx_fk, witness)))
-            return {};
+    std::transform(policy, txs.cbegin(), txs.cend(), transactions->begin(),
+        [&](const auto& tx_fk) NOEXCEPT -> transaction::cptr
+        {
+            if (fail.load(relaxed))
+                return {};
+
+            auto tx = get_transaction(tx_fk, witness);
+            if (!tx)
+                fail.store(true, relaxed);
+
+            return tx;
+        });
+
+    if (fail.load(relaxed))
+        return {};
 
     return transactions;
 }
@@ -129,13 +145,13 @@ typename CLASS::header::cptr CLASS::get_header(
 
 TEMPLATE
 typename CLASS::block::cptr CLASS::get_block(const header_link& link,
-    bool witness) const NOEXCEPT
+    bool witness, bool turbo) const NOEXCEPT
 {
     const auto header = get_header(link);
     if (!header)
         return {};
 
-    const auto transactions = get_transactions(link, witness);
+    const auto transactions = get_transactions(link, witness, turbo);
     if (!transactions)
         return {};
 
@@ -20,6 +20,8 @@
 #define LIBBITCOIN_DATABASE_QUERY_ARCHIVE_CHAIN_WRITER_IPP
 
 #include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <ranges>
 #include <utility>
 #include <bitcoin/database/define.hpp>
@@ -83,14 +85,20 @@ code CLASS::set_code(const transaction& tx) NOEXCEPT
     if (tx_fk.is_terminal())
         return error::tx_tx_allocate;
 
-    return set_code(tx_fk, tx, false);
+    const auto ec = set_code(tx_fk, tx, false);
+
+    // Unassociated tx is indexed by short id for compact block reconstruction.
+    if (!ec && short_ids_.enabled())
+        short_ids_.push(tx_fk.value, tx.get_hash(true));
+
+    return ec;
 }
 
 TEMPLATE
 code CLASS::set_code(const tx_link& tx_fk, const transaction& tx,
     bool bypass) NOEXCEPT
 {
-    // This is the only multitable write query (except initialize/genesis).
+    // Multitable write query (as are block archival and initialize/genesis).
 
     if (tx.is_empty())
         return error::tx_empty;
@@ -230,13 +238,244 @@ code CLASS::set_code(const tx_link& tx_fk, const transaction& tx,
         }
     }
 
-    // Commit tx to search (hashmap).
+    // Commit tx to search (hashmap), filter first to preclude false negative.
     // tx.get_hash() assumes cached or is not thread safe.
+    store_.tx_bloom.insert(tx.get_hash(false));
     return store_.tx.commit(tx_fk, tx.get_hash(false)) ?
         error::success : error::tx_tx_commit;
     // ========================================================================
 }
 
+// set transactions of block
+// ----------------------------------------------------------------------------
+// Same table effect as set_code(tx_fk, tx, bypass) for each tx in order, but
+// with one allocation per table for the block and parallel serialization.
+
+TEMPLATE
+code CLASS::set_code(const tx_link& tx_fks, const block& block,
+    bool bypass) NOEXCEPT
+{
+    using namespace system;
+    using ix = linkage<schema::index>;
+    const auto& txs = *block.transactions_ptr();
+    const auto count = txs.size();
+
+    // Table-relative position of each tx, sizes are cached so this is cheap.
+    struct slot
+    {
+        size_t input{};
+        size_t output{};
+        size_t ins{};
+        size_t outs{};
+    };
+
+    size_t inputs{};
+    size_t outputs{};
+    size_t points{};
+    size_t values{};
+    std::vector<slot> slots(count);
+    for (size_t index{}; index < count; ++index)
+    {
+        const auto& tx = *txs.at(index);
+        if (tx.is_empty())
+            return error::tx_empty;
+
+        slots.at(index) = { inputs, outputs, points, values };
+        inputs += table::input::put_ref{ {}, tx }.count();
+        outputs += table::output::put_ref{ {}, {}, tx }.count();
+        points += tx.inputs();
+        values += tx.outputs();
+    }
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Allocate contiguously for all txs of the block.
+    const auto in_fk = store_.input.allocate(
+        possible_narrow_cast<input_link::integer>(inputs));
+    if (in_fk.is_terminal())
+        return error::tx_input_put;
+
+    const auto out_fk = store_.output.allocate(
+        possible_narrow_cast<output_link::integer>(outputs));
+    if (out_fk.is_terminal())
+        return error::tx_output_put;
+
+    const auto ins_fk = store_.ins.allocate(
+        possible_narrow_cast<ins_link::integer>(points));
+    if (ins_fk.is_terminal())
+        return error::tx_ins_put;
+
+    const auto outs_fk = store_.outs.allocate(
+        possible_narrow_cast<outs_link::integer>(values));
+    if (outs_fk.is_terminal())
+        return error::tx_outs_put;
+
+    // Expand synchronizes keys with ins_fk, entries set into same offset.
+    if (!store_.point.expand(possible_narrow_cast<point_link::integer>(
+        ins_fk + points)))
+        return error::tx_point_allocate;
+
+    address_link ad_fk{};
+    if (address_enabled())
+    {
+        ad_fk = store_.address.allocate(
+            possible_narrow_cast<address_link::integer>(values));
+        if (ad_fk.is_terminal())
+            return error::tx_address_allocate;
+    }
+
+    // Serialize txs into their slots in parallel.
+    // All allocation must precede get_memory(), as remap requires exclusive.
+    // Commit is deferred for point/address index consistency.
+    {
+        std::atomic<error::error_t> fault{ error::success };
+        std::vector<size_t> offsets(count);
+        std::iota(offsets.begin(), offsets.end(), zero);
+        constexpr auto parallel = poolstl::execution::par;
+        constexpr auto relaxed = std::memory_order_relaxed;
+        const auto input_ptr = store_.input.get_memory();
+        const auto output_ptr = store_.output.get_memory();
+        const auto ins_ptr = store_.ins.get_memory();
+        const auto outs_ptr = store_.outs.get_memory();
+        const auto tx_ptr = store_.tx.get_memory();
+
+        std::for_each(parallel, offsets.cbegin(), offsets.cend(),
+            [&](const size_t& offset) NOEXCEPT
+            {
+                if (fault.load(relaxed) != error::success)
+                    return;
+
+                const auto& tx = *txs.at(offset);
+                const auto& at = slots.at(offset);
+                const auto tx_fk = possible_narrow_cast<tx_link::integer>(
+                    tx_fks + offset);
+                const auto in = possible_narrow_cast<input_link::integer>(
+                    in_fk + at.input);
+                const auto out = possible_narrow_cast<output_link::integer>(
+                    out_fk + at.output);
+                const auto ins = possible_narrow_cast<ins_link::integer>(
+                    ins_fk + at.ins);
+                const auto outs = possible_narrow_cast<outs_link::integer>(
+                    outs_fk + at.outs);
+
+                auto ec = error::success;
+                if (!store_.input.put(input_ptr, in,
+                    table::input::put_ref{ {}, tx }))
+                    ec = error::tx_input_put;
+                else if (!store_.output.put(output_ptr, out,
+                    table::output::put_ref{ {}, tx_fk, tx }))
+                    ec = error::tx_output_put;
+                else if (!store_.ins.put(ins_ptr, ins,
+                    table::ins::put_ref{ {}, in, tx_fk, tx }))
+                    ec = error::tx_ins_put;
+                else if (!store_.outs.put(outs_ptr, outs,
+                    table::outs::put_ref{ {}, out, tx }))
+                    ec = error::tx_outs_put;
+
+                // tx.get_hash() assumes cached or is not thread safe (per tx).
+                else if (!store_.tx.set(tx_ptr, tx_fk, tx.get_hash(false),
+                    table::transaction::put_ref
+                    {
+                        {},
+                        tx,
+                        possible_narrow_cast<ix::integer>(tx.inputs()),
+                        possible_narrow_cast<ix::integer>(tx.outputs()),
+                        ins,
+                        outs
+                    }))
+                    ec = error::tx_tx_set;
+
+                if (ec != error::success)
+                    fault.store(ec, relaxed);
+            });
+
+        if (const auto ec = fault.load(relaxed); ec != error::success)
+            return ec;
+    }
+
+    // Commit points (hashmap), sequential and in tx order.
+    // If dirty we must guard against duplicates (see set_code(tx_fk, ...)).
+    {
+        const auto guard = store_.is_dirty() || !bypass;
+        std::vector<chain::point> twins{};
+        auto point_fk = ins_fk;
+        auto ptr = store_.point.get_memory();
+        for (const auto& tx: txs)
+        {
+            const auto coinbase = tx->is_coinbase();
+            for (const auto& in: *tx->inputs_ptr())
+            {
+                if (coinbase)
+                {
+                    if (!store_.point.put(ptr, point_fk++, in->point(),
+                        table::point::record{}))
+                        return error::tx_null_point_put;
+                }
+                else if (guard)
+                {
+                    bool duplicate{};
+                    if (!store_.point.put(duplicate, ptr, point_fk++,
+                        in->point(), table::point::record{}))
+                        return error::tx_point_put;
+
+                    if (duplicate)
+                        twins.push_back(in->point());
+                }
+                else
+                {
+                    if (!store_.point.put(ptr, point_fk++, in->point(),
+                        table::point::record{}))
+                        return error::tx_point_put;
+                }
+            }
+        }
+
+        ptr.reset();
+
+        // As few duplicates are expected, duplicate domain is only 2^16.
+        // Return of tx_duplicate_put implies link domain has overflowed.
+        for (const auto& twin: twins)
+            if (!store_.duplicate.exists(twin))
+                if (!store_.duplicate.put(twin, table::duplicate::record{}))
+                    return error::tx_duplicate_put;
+    }
+
+    // Commit address index records (hashmap).
+    if (address_enabled())
+    {
+        constexpr auto value_parent_diff = sizeof(uint64_t) - tx_link::size;
+        auto output_fk = out_fk;
+        const auto ptr = store_.address.get_memory();
+        for (const auto& tx: txs)
+        {
+            for (const auto& output: *tx->outputs_ptr())
+            {
+                if (!store_.address.put(ptr, ad_fk++, output->script().hash(),
+                    table::address::record{ {}, output_fk }))
+                    return error::tx_address_put;
+
+                // See outs::put_ref.
+                output_fk.value += (variable_size(output->value()) +
+                    output->serialized_size() - value_parent_diff);
+            }
+        }
+    }
+
+    // Commit txs to search (hashmap), filter first to preclude false negative.
+    auto tx_fk = tx_fks;
+    const auto ptr = store_.tx.get_memory();
+    for (const auto& tx: txs)
+    {
+        store_.tx_bloom.insert(tx->get_hash(false));
+        if (!store_.tx.commit(ptr, tx_fk++, tx->get_hash(false)))
+            return error::tx_tx_commit;
+    }
+
+    return error::success;
+    // ========================================================================
+}
+
 // set header
 // ----------------------------------------------------------------------------
 
@@ -299,6 +538,73 @@ code CLASS::set_code(header_link& out_fk, const header& header,
     // ========================================================================
 }
 
+TEMPLATE
+code CLASS::set_code(header_links& out_fks,
+    const header_entries& entries) NOEXCEPT
+{
+    using namespace system;
+    out_fks.clear();
+    if (entries.empty())
+        return error::success;
+
+    // Parent is the preceding entry, resolved upon allocation, or archived.
+    // Parent must be missing iff its hash is null.
+    const auto count = entries.size();
+    std::vector<bool> chained(count);
+    std::vector<header_link> parents(count);
+    for (auto index = zero; index < count; ++index)
+    {
+        // header.get_hash() assumes cached or is not thread safe.
+        const auto& previous = entries.at(index).header->previous_block_hash();
+        if (!is_zero(index) &&
+            previous == entries.at(sub1(index)).header->get_hash())
+        {
+            chained.at(index) = true;
+            continue;
+        }
+
+        parents.at(index) = to_header(previous);
+        if (parents.at(index).is_terminal() != (previous == null_hash))
+            return error::orphan_block;
+    }
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // All allocation must precede get_memory(), as remap requires exclusive.
+    auto header_fk = store_.header.allocate(
+        possible_narrow_cast<header_link::integer>(count));
+    if (header_fk.is_terminal())
+        return error::header_put;
+
+    // Records are set through one memory_ptr and committed in order, so that
+    // each parent is searchable before its child.
+    out_fks.reserve(count);
+    const auto ptr = store_.header.get_memory();
+    for (auto index = zero; index < count; ++index)
+    {
+        const auto& entry = entries.at(index);
+        const auto parent_fk = chained.at(index) ?
+            header_link{ out_fks.back() } : parents.at(index);
+
+        if (!store_.header.put(ptr, header_fk, entry.header->get_hash(),
+            table::header::put_ref
+            {
+                {},
+                entry.ctx,
+                entry.milestone,
+                parent_fk,
+                *entry.header
+            }))
+            return error::header_put;
+
+        out_fks.push_back(header_fk++);
+    }
+
+    return error::success;
+    // ========================================================================
+}
+
 // set full block
 // ----------------------------------------------------------------------------
 // strong is set for checkpointed blocks only, as they are always strong chain.
@@ -386,11 +692,8 @@ code CLASS::set_code(const block& block, const header_link& key,
     if (tx_fks.is_terminal())
         return error::tx_tx_allocate;
 
-    code ec{};
-    auto fk = tx_fks;
-    for (const auto& tx: *block.transactions_ptr())
-        if ((ec = set_code(fk++, *tx, bypass)))
-            return ec;
+    if (const auto ec = set_code(tx_fks, block, bypass))
+        return ec;
 
     // Optional hash, only has value on height intervals.
     auto interval = create_interval(key, height);
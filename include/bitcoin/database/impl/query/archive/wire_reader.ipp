@@ -20,6 +20,9 @@
 #define LIBBITCOIN_DATABASE_QUERY_ARCHIVE_WIRE_READER_IPP
 
 #include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <numeric>
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
@@ -151,6 +154,16 @@ bool CLASS::get_wire_block(bytewriter& sink, const header_link& link,
 
 TEMPLATE
 data_chunk CLASS::get_wire_header(const header_link& link) const NOEXCEPT
+{
+    if (!wire_cache_.enabled())
+        return get_wire_header_(link);
+
+    const auto data = get_cached_wire_header(link);
+    return data ? *data : data_chunk{};
+}
+
+TEMPLATE
+data_chunk CLASS::get_wire_header_(const header_link& link) const NOEXCEPT
 {
     using namespace system;
     data_chunk data(chain::header::serialized_size());
@@ -166,38 +179,398 @@ data_chunk CLASS::get_wire_header(const header_link& link) const NOEXCEPT
 TEMPLATE
 data_chunk CLASS::get_wire_tx(const tx_link& link, bool witness) const NOEXCEPT
 {
-    using namespace system;
     size_t size{};
     if (!get_tx_size(size, link, witness))
         return {};
 
     data_chunk data(size);
-    stream::flip::fast ostream(data);
-    flip::bytes::fast out(ostream);
-    if (!get_wire_tx(out, link, witness) || !out)
+    if (!get_wire_tx(data.data(), size, link, witness))
         return {};
 
     return data;
 }
 
 TEMPLATE
-data_chunk CLASS::get_wire_block(const header_link& link,
-    bool witness) const NOEXCEPT
+data_chunk CLASS::get_wire_block(const header_link& link, bool witness,
+    bool turbo) const NOEXCEPT
+{
+    if (!wire_cache_.enabled())
+        return get_wire_block_(link, witness, turbo);
+
+    const auto data = get_cached_wire_block(link, witness, turbo);
+    return data ? *data : data_chunk{};
+}
+
+TEMPLATE
+data_chunk CLASS::get_wire_block_(const header_link& link, bool witness,
+    bool turbo) const NOEXCEPT
 {
     using namespace system;
     size_t size{};
     if (!get_block_size(size, link, witness))
         return {};
 
+    const auto txs = to_transactions(link);
+    if (txs.empty())
+        return {};
+
+    // Layout is precomputed from cached tx sizes, so each tx has its offset.
+    const auto count = txs.size();
+    std::vector<size_t> offsets(count);
+    std::vector<size_t> sizes(count);
+    auto offset = chain::header::serialized_size() + variable_size(count);
+    for (size_t index{}; index < count; ++index)
+    {
+        if (!get_tx_size(sizes.at(index), txs.at(index), witness))
+            return {};
+
+        offsets.at(index) = offset;
+        offset += sizes.at(index);
+    }
+
+    // Cached block size must equal the sum of its parts.
+    if (offset != size)
+        return {};
+
     data_chunk data(size);
     stream::flip::fast ostream(data);
     flip::bytes::fast out(ostream);
-    if (!get_wire_block(out, link, witness) || !out)
+    if (!get_wire_header(out, link))
+        return {};
+
+    out.write_variable(count);
+    if (!out)
+        return {};
+
+    // Txs are serialized concurrently into their disjoint slots (turbo).
+    stopper fail{};
+    std::vector<size_t> indexes(count);
+    std::iota(indexes.begin(), indexes.end(), zero);
+    constexpr auto relaxed = std::memory_order_relaxed;
+    const auto policy = poolstl::execution::par_if(turbo);
+
+    std::for_each(policy, indexes.cbegin(), indexes.cend(),
+        [&](const size_t& index) NOEXCEPT
+        {
+            if (fail.load(relaxed))
+                return;
+
+            const auto slot = std::next(data.data(), offsets.at(index));
+            if (!get_wire_tx(slot, sizes.at(index), txs.at(index), witness))
+                fail.store(true, relaxed);
+        });
+
+    if (fail.load(relaxed))
         return {};
 
     return data;
 }
 
+// Cached wire encoding (shared, populated on first read).
+// ----------------------------------------------------------------------------
+// A burst of requests for a newly confirmed block is served from one encoding.
+// Entries are keyed by header link and removed on pop_confirmed/set_unstrong.
+
+TEMPLATE
+wire_cache::chunk_cptr CLASS::get_cached_wire_header(
+    const header_link& link) const NOEXCEPT
+{
+    constexpr auto type = wire_cache::kind::header;
+    if (auto data = wire_cache_.get(link.value, type))
+        return data;
+
+    auto data = get_wire_header_(link);
+    if (data.empty())
+        return {};
+
+    const auto out = system::to_shared<const data_chunk>(std::move(data));
+    wire_cache_.put(link.value, type, out);
+    return out;
+}
+
+TEMPLATE
+wire_cache::chunk_cptr CLASS::get_cached_wire_block(const header_link& link,
+    bool witness, bool turbo) const NOEXCEPT
+{
+    const auto type = witness ? wire_cache::kind::witness_block :
+        wire_cache::kind::block;
+
+    if (auto data = wire_cache_.get(link.value, type))
+        return data;
+
+    auto data = get_wire_block_(link, witness, turbo);
+    if (data.empty())
+        return {};
+
+    const auto out = system::to_shared<const data_chunk>(std::move(data));
+    wire_cache_.put(link.value, type, out);
+    return out;
+}
+
+TEMPLATE
+wire_cache::metrics CLASS::get_wire_cache_metrics() const NOEXCEPT
+{
+    return wire_cache_.get_metrics();
+}
+
+// Scatter-gather wire encoding (segments reference mapped store memory).
+// ----------------------------------------------------------------------------
+// Input scripts and witnesses and output scripts are stored in wire encoding,
+// so these are referenced in place. Generated bytes are sized exactly from tx
+// records and written once to scratch. Caller must release segments promptly.
+
+TEMPLATE
+bool CLASS::get_wire_tx(wire_segments& out, const tx_link& link,
+    bool witness) const NOEXCEPT
+{
+    return get_wire_segments(out, {}, { link }, witness);
+}
+
+TEMPLATE
+bool CLASS::get_wire_block(wire_segments& out, const header_link& link,
+    bool witness) const NOEXCEPT
+{
+    out.reset();
+    if (link.is_terminal())
+        return false;
+
+    const auto txs = to_transactions(link);
+    return !txs.empty() && get_wire_segments(out, link, txs, witness);
+}
+
+// protected
+// ----------------------------------------------------------------------------
+// Writes to a buffer of exactly the tx wire size. The witness section begins
+// at a computable offset (light - locktime + marker/flag), so inputs are
+// navigated once with scripts and witnesses written to separate positions.
+
+TEMPLATE
+bool CLASS::get_wire_tx(uint8_t* data, size_t size, const tx_link& link,
+    bool witness) const NOEXCEPT
+{
+    using namespace system;
+    constexpr auto locktime_size = sizeof(uint32_t);
+    constexpr auto marker_size = two;
+
+    table::transaction::record tx{};
+    if (!store_.tx.get(link, tx))
+        return false;
+
+    const auto witnessed = witness && (tx.heavy != tx.light);
+    if (is_null(data) || size != (witnessed ? tx.heavy : tx.light))
+        return false;
+
+    table::outs::record outs{};
+    outs.out_fks.resize(tx.outs_count);
+    if (!store_.outs.get(tx.outs_fk, outs))
+        return false;
+
+    // Point links are contiguous (computed).
+    const auto ins_begin = tx.point_fk;
+    const auto ins_count = tx.ins_count;
+    const auto ins_final = ins_begin + ins_count;
+
+    // Nominal parts precede the witness section, locktime follows it.
+    const auto witness_start = tx.light - locktime_size + marker_size;
+    const auto nominal = witnessed ? witness_start : size - locktime_size;
+    stream::flip::fast ostream(data, possible_narrow_and_sign_cast<ptrdiff_t>(
+        nominal));
+    flip::bytes::fast out(ostream);
+
+    const auto tail = std::next(data, nominal);
+    stream::flip::fast tstream(tail, possible_narrow_and_sign_cast<ptrdiff_t>(
+        size - nominal));
+    flip::bytes::fast end(tstream);
+
+    out.write_4_bytes_little_endian(tx.version);
+
+    if (witnessed)
+    {
+        out.write_byte(chain::witness_marker);
+        out.write_byte(chain::witness_enabled);
+    }
+
+    out.write_variable(ins_count);
+    if (witnessed)
+    {
+        for (auto fk = ins_begin; fk < ins_final; ++fk)
+        {
+            table::point::wire_point point{ {}, out };
+            table::ins::get_input ins{};
+            table::input::wire_script_witness in{ {}, out, end };
+            if (!store_.point.get(fk, point) ||
+                !store_.ins.get(fk, ins) ||
+                !store_.input.get(ins.input_fk, in))
+                return false;
+
+            out.write_4_bytes_little_endian(ins.sequence);
+        }
+    }
+    else
+    {
+        for (auto fk = ins_begin; fk < ins_final; ++fk)
+            if (!get_wire_input(out, fk))
+                return false;
+    }
+
+    out.write_variable(outs.out_fks.size());
+    for (const auto& fk: outs.out_fks)
+        if (!get_wire_output(out, fk))
+            return false;
+
+    end.write_4_bytes_little_endian(tx.locktime);
+
+    // Both parts must exactly fill their regions.
+    return out && end &&
+        (out.get_write_position() == nominal) &&
+        (end.get_write_position() == size - nominal);
+}
+
+// Terminal header link implies a single tx (no header or tx count).
+TEMPLATE
+bool CLASS::get_wire_segments(wire_segments& out, const header_link& link,
+    const tx_links& txs, bool witness) const NOEXCEPT
+{
+    using namespace system;
+    constexpr auto point_size = chain::point::serialized_size();
+    constexpr auto sequence_size = sizeof(uint32_t);
+    constexpr auto value_size = sizeof(uint64_t);
+    constexpr auto version_locktime_size = sizeof(uint32_t) + sizeof(uint32_t);
+    constexpr auto marker_size = two;
+    const auto block = !link.is_terminal();
+
+    out.reset();
+    std::vector<table::transaction::record> records(txs.size());
+
+    // Generated (scratch) bytes are exactly computable from tx records.
+    auto scratch = block ? chain::header::serialized_size() +
+        variable_size(txs.size()) : zero;
+
+    for (size_t index{}; index < txs.size(); ++index)
+    {
+        auto& tx = records.at(index);
+        if (!store_.tx.get(txs.at(index), tx))
+            return false;
+
+        const auto witnessed = witness && (tx.heavy != tx.light);
+        scratch += version_locktime_size + (witnessed ? marker_size : zero) +
+            variable_size(tx.ins_count) + variable_size(tx.outs_count) +
+            tx.ins_count * (point_size + sequence_size) +
+            tx.outs_count * value_size;
+    }
+
+    // Guards retain mapped bodies (precluding remap) while segments are used.
+    // Table reads under a guard must use that guard (shared lock reentrancy).
+    const auto inputs = store_.input.get_memory();
+    const auto outputs = store_.output.get_memory();
+    if (!inputs || !outputs)
+        return false;
+
+    out.guards = { inputs, outputs };
+    out.scratch.resize(scratch);
+    stream::flip::fast ostream(out.scratch);
+    flip::bytes::fast sink(ostream);
+
+    // Close the pending scratch segment, and optionally add a mapped segment.
+    size_t mark{};
+    const auto append = [&](const uint8_t* data, size_t size) NOEXCEPT
+    {
+        const auto position = sink.get_write_position();
+        if (position > mark)
+            out.segments.push_back({ std::next(out.scratch.data(), mark),
+                position - mark });
+
+        mark = position;
+        if (!is_zero(size))
+            out.segments.push_back({ data, size });
+    };
+
+    if (block)
+    {
+        if (!get_wire_header(sink, link))
+            return false;
+
+        sink.write_variable(txs.size());
+    }
+
+    wire_segment_list witnesses{};
+    for (const auto& tx: records)
+    {
+        table::outs::record outs{};
+        outs.out_fks.resize(tx.outs_count);
+        if (!store_.outs.get(tx.outs_fk, outs))
+            return false;
+
+        // Point links are contiguous (computed).
+        const auto ins_begin = tx.point_fk;
+        const auto ins_final = ins_begin + tx.ins_count;
+        const auto witnessed = witness && (tx.heavy != tx.light);
+
+        sink.write_4_bytes_little_endian(tx.version);
+
+        if (witnessed)
+        {
+            sink.write_byte(chain::witness_marker);
+            sink.write_byte(chain::witness_enabled);
+        }
+
+        // Witnesses follow outputs, but are collected in the same pass.
+        witnesses.clear();
+        sink.write_variable(tx.ins_count);
+        for (auto fk = ins_begin; fk < ins_final; ++fk)
+        {
+            table::point::wire_point point{ {}, sink };
+            table::ins::get_input ins{};
+            table::input::wire_spans in{};
+            if (!store_.point.get(fk, point) ||
+                !store_.ins.get(fk, ins) ||
+                !store_.input.get(inputs, ins.input_fk, in))
+                return false;
+
+            // Slab link is body byte position.
+            const auto start = inputs->offset(ins.input_fk);
+            if (is_null(start))
+                return false;
+
+            append(start, in.script);
+            sink.write_4_bytes_little_endian(ins.sequence);
+
+            if (witnessed)
+                witnesses.push_back({ std::next(start, in.script),
+                    in.witness });
+        }
+
+        sink.write_variable(tx.outs_count);
+        for (const auto& fk: outs.out_fks)
+        {
+            table::output::wire_spans output{};
+            if (!store_.output.get(outputs, fk, output))
+                return false;
+
+            const auto start = outputs->offset(fk);
+            if (is_null(start))
+                return false;
+
+            sink.write_8_bytes_little_endian(output.value);
+            append(std::next(start, output.start), output.script);
+        }
+
+        for (const auto& segment: witnesses)
+            append(segment.data, segment.size);
+
+        sink.write_4_bytes_little_endian(tx.locktime);
+    }
+
+    append(nullptr, zero);
+    if (!sink || (sink.get_write_position() != scratch))
+    {
+        out.reset();
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
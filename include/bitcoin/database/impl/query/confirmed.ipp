@@ -142,6 +142,12 @@ bool CLASS::is_confirmed_all_prevouts(const tx_link& link) const NOEXCEPT
 TEMPLATE
 bool CLASS::is_confirmed_spent(const output_link& link) const NOEXCEPT
 {
+    // A spender is strong *and* its block is confirmed (by bitmap).
+    // The bitmap is maintained by push_confirmed/pop_confirmed, and covers
+    // blocks confirmed before it existed only once rebuilt (see rebuild_spent).
+    if (store_.spent.is_complete())
+        return is_spent_bit(to_outs(link));
+
     // At least one spender is strong *and* its block is confirmed (by height).
     const auto ins = to_spenders(link);
     return !ins.empty() && std::any_of(ins.cbegin(), ins.cend(),
@@ -151,6 +157,17 @@ bool CLASS::is_confirmed_spent(const output_link& link) const NOEXCEPT
         });
 }
 
+TEMPLATE
+bool CLASS::is_confirmed_spent(const tx_link& link,
+    uint32_t index) const NOEXCEPT
+{
+    // As above, without resolving the output index (by bitmap).
+    if (store_.spent.is_complete())
+        return is_spent_bit(to_outs(link, index));
+
+    return is_confirmed_spent(to_output(link, index));
+}
+
 TEMPLATE
 bool CLASS::is_unconfirmed_spent(const output_link& link) const NOEXCEPT
 {
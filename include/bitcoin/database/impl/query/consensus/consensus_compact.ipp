@@ -19,12 +19,119 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_CONSENSUS_COMPACT_IPP
 #define LIBBITCOIN_DATABASE_QUERY_CONSENSUS_COMPACT_IPP
 
+#include <algorithm>
 #include <iterator>
+#include <memory>
+#include <shared_mutex>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
 namespace database {
 
+// Short ids (BIP152).
+// ----------------------------------------------------------------------------
+// Reconstruction matches short ids against recent unconfirmed txs, which are
+// retained in memory (with witness hash) as they are archived or pooled.
+// Matching does not read the store, though pooled txs are read by reference.
+
+TEMPLATE
+bool CLASS::get_short_id_key(short_ids::key& out, const header_link& link,
+    uint64_t nonce) const NOEXCEPT
+{
+    const auto header = get_wire_header(link);
+    if (header.empty())
+        return false;
+
+    out = short_ids::to_key(header, nonce);
+    return true;
+}
+
+TEMPLATE
+short_ids::map_cptr CLASS::get_short_ids(
+    const short_ids::key& key) const NOEXCEPT
+{
+    constexpr auto parallel = poolstl::execution::par;
+    const auto to_id = [&key](const short_ids::entry& entry) NOEXCEPT
+    {
+        return short_ids::id{ short_ids::to_id(key, entry.hash), entry.link };
+    };
+
+    // A cached map of the key is extended by txs pushed since it was built.
+    // Overwritten txs remain until the map reaches twice the ring capacity
+    // and is rebuilt, which is harmless as their tx links remain valid.
+    size_t sequence{};
+    short_ids::entries entries{};
+    const auto cached = short_ids_.get(key, sequence);
+    if (cached && short_ids_.since(entries, sequence))
+    {
+        if (entries.empty())
+            return cached;
+
+        if (cached->size() + entries.size() <= two * short_ids_.capacity())
+        {
+            short_ids::map added(entries.size());
+            std::transform(parallel, entries.begin(), entries.end(),
+                added.begin(), to_id);
+            std::sort(added.begin(), added.end());
+
+            const auto map = std::make_shared<short_ids::map>();
+            map->reserve(cached->size() + added.size());
+            std::merge(cached->begin(), cached->end(), added.begin(),
+                added.end(), std::back_inserter(*map));
+
+            short_ids_.put(key, sequence, map);
+            return map;
+        }
+    }
+
+    entries.clear();
+    sequence = short_ids_.snapshot(entries);
+    const auto map = std::make_shared<short_ids::map>(entries.size());
+    std::transform(parallel, entries.begin(), entries.end(), map->begin(),
+        to_id);
+    std::sort(parallel, map->begin(), map->end());
+
+    short_ids_.put(key, sequence, map);
+    return map;
+}
+
+TEMPLATE
+tx_links CLASS::to_short_id_txs(const short_ids::key& key,
+    uint64_t id) const NOEXCEPT
+{
+    tx_links out{};
+    for (const auto reference: short_ids::find(*get_short_ids(key), id))
+        if (!is_pooled_reference(reference))
+            out.emplace_back(system::possible_narrow_cast<tx_link::integer>(
+                reference));
+
+    return out;
+}
+
+TEMPLATE
+typename CLASS::transactions CLASS::get_short_id_pooled(
+    const short_ids::key& key, uint64_t id) const NOEXCEPT
+{
+    transactions out{};
+    if (!pool_enabled())
+        return out;
+
+    // Shared lock precludes a concurrent rotation from emptying either table.
+    std::shared_lock lock{ pool_mutex_ };
+    for (const auto reference: short_ids::find(*get_short_ids(key), id))
+    {
+        if (!is_pooled_reference(reference))
+            continue;
+
+        // The link may have been reused by a rotation, so the id is matched.
+        const auto tx = get_pooled_reference(reference);
+        if (tx && short_ids::to_id(key, tx->get_hash(true)) == id)
+            out.push_back(tx);
+    }
+
+    return out;
+}
+
 // Compact blocks.
 /// TODO: apply these to compact block confirmation, as the block will
 /// TODO: associate existing txs, making it impossible to rely on the
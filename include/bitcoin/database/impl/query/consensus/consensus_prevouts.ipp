@@ -27,7 +27,8 @@ namespace database {
     
 // Prevouts caching.
 // Prevouts are cached during validation and read during confirmation.
-// The table is purged once per process execution when node is coalesced.
+// The table is purged once per process execution when node is coalesced, by
+// swapping to a second table (generation) and emptying the first on snapshot.
 // ----------------------------------------------------------------------------
 
 TEMPLATE
@@ -43,14 +44,17 @@ code CLASS::get_prevouts(point_sets& sets, size_t points,
     cache.spends.resize(points);
     const auto prevout = to_prevout(link);
 
-    // Transactor required for prevout read because of pruning.
+    // Transactor required for prevout read because of pruning. The prior
+    // generation is read in case of restart following a prune (not by a
+    // follower, as the writer truncates it upon snapshot).
     // ========================================================================
     {
         const auto scope = store_.get_transactor();
 
-        if (!store_.prevout.at(prevout, cache))
+        if (!store_.current_prevout().at(prevout, cache) &&
+            (!store_.is_prior_readable() ||
+            !store_.prior_prevout().at(prevout, cache)))
             return error::integrity_get_prevouts;
-
     }
     // ========================================================================
 
@@ -94,7 +98,7 @@ bool CLASS::set_prevouts(const header_link& link, const block& block) NOEXCEPT
 
     // Clean single allocation failure (e.g. disk full).
     const table::prevout::slab_put_ref prevouts{ {}, doubles, block };
-    return store_.prevout.put(prevout, prevouts);
+    return store_.current_prevout().put(prevout, prevouts);
     // ========================================================================
 }
 
@@ -19,6 +19,8 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_CONSENSUS_STATES_IPP
 #define LIBBITCOIN_DATABASE_QUERY_CONSENSUS_STATES_IPP
 
+#include <mutex>
+#include <shared_mutex>
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
@@ -179,18 +181,30 @@ bool CLASS::is_block_validated(code& state, const header_link& link,
     }
 }
 
+// Tx states are read from the current and then the prior generation (other
+// than by a follower, for which the prior may have been reset by the writer).
 TEMPLATE
 code CLASS::get_tx_state(const tx_link& link,
     const context& ctx) const NOEXCEPT
 {
+    std::shared_lock lock{ validated_tx_mutex_ };
+    const auto generation = store_.validated_tx_generation();
+
     table::validated_tx::slab_get_code valid{};
-    for (auto it = store_.validated_tx.it(link); it; ++it)
+    for (const auto next: { generation, add1(generation) })
     {
-        if (!store_.validated_tx.get(it, valid))
-            return error::integrity;
+        if (next != generation && !store_.is_prior_readable())
+            break;
+
+        const auto& cache = to_validated_tx(next);
+        for (auto it = cache.it(link); it; ++it)
+        {
+            if (!cache.get(it, valid))
+                return error::integrity;
 
-        if (is_sufficient(ctx, valid.ctx))
-            return to_tx_code(valid.code);
+            if (is_sufficient(ctx, valid.ctx))
+                return to_tx_code(valid.code);
+        }
     }
 
     return error::unvalidated;
@@ -200,18 +214,27 @@ TEMPLATE
 code CLASS::get_tx_state(uint64_t& fee, size_t& sigops, const tx_link& link,
     const context& ctx) const NOEXCEPT
 {
+    std::shared_lock lock{ validated_tx_mutex_ };
+    const auto generation = store_.validated_tx_generation();
 
     table::validated_tx::slab valid{};
-    for (auto it = store_.validated_tx.it(link); it; ++it)
+    for (const auto next: { generation, add1(generation) })
     {
-        if (!store_.validated_tx.get(it, valid))
-            return error::integrity;
+        if (next != generation && !store_.is_prior_readable())
+            break;
 
-        if (is_sufficient(ctx, valid.ctx))
+        const auto& cache = to_validated_tx(next);
+        for (auto it = cache.it(link); it; ++it)
         {
-            fee = valid.fee;
-            sigops = valid.sigops;
-            return to_tx_code(valid.code);
+            if (!cache.get(it, valid))
+                return error::integrity;
+
+            if (is_sufficient(ctx, valid.ctx))
+            {
+                fee = valid.fee;
+                sigops = valid.sigops;
+                return to_tx_code(valid.code);
+            }
         }
     }
 
@@ -287,19 +310,101 @@ bool CLASS::set_tx_state(const tx_link& link, const context& ctx,
     uint64_t fee, size_t sigops, schema::tx_state state) NOEXCEPT
 {
     using sigs = linkage<schema::sigops>;
+    std::shared_lock lock{ validated_tx_mutex_ };
+    const auto generation = store_.validated_tx_generation();
 
     // ========================================================================
     const auto scope = store_.get_transactor();
     using namespace system;
 
     // Clean single allocation failure (e.g. disk full).
-    return store_.validated_tx.put(link, table::validated_tx::slab
+    return to_validated_tx(generation).put(link, table::validated_tx::slab
     {
         {}, ctx, state, fee, possible_narrow_cast<sigs::integer>(sigops)
     });
     // ========================================================================
 }
 
+// Rotation.
+// ----------------------------------------------------------------------------
+// validated_tx is a cache, so states of contexts below the window are dropped
+// by rotation to a second table of the same configuration. The emptied prior
+// generation becomes current and retained states are then copied into it from
+// the former current, concurrent with validation, as readers consult both. The
+// mutex excludes reads and writes only from the truncation of a generation.
+
+TEMPLATE
+bool CLASS::rotate_validated_tx() NOEXCEPT
+{
+    const auto window = store_.validated_tx_window();
+    if (is_zero(window))
+        return true;
+
+    const auto floor = system::floored_subtract(get_top_candidate(), window);
+    size_t generation{};
+    {
+        ///////////////////////////////////////////////////////////////////////
+        std::unique_lock lock{ validated_tx_mutex_ };
+        generation = store_.validated_tx_generation();
+
+        // ====================================================================
+        const auto scope = store_.get_transactor();
+
+        // Retained states of the prior generation were copied upon its swap.
+        if (!to_validated_tx(add1(generation)).reset())
+            return false;
+
+        store_.set_validated_tx_generation(add1(generation));
+        // ====================================================================
+        ///////////////////////////////////////////////////////////////////////
+    }
+
+    // Shared lock precludes a concurrent rotation from emptying either table.
+    std::shared_lock lock{ validated_tx_mutex_ };
+    return copy_validated_tx(to_validated_tx(generation),
+        to_validated_tx(add1(generation)), floor);
+}
+
+// protected
+TEMPLATE
+table::validated_tx& CLASS::to_validated_tx(size_t generation) const NOEXCEPT
+{
+    return system::is_odd(generation) ? store_.validated_tx1 :
+        store_.validated_tx;
+}
+
+// protected
+TEMPLATE
+bool CLASS::copy_validated_tx(table::validated_tx& from,
+    table::validated_tx& to, size_t floor) NOEXCEPT
+{
+    using namespace system;
+    using link = table::validated_tx::link;
+
+    // Slabs are contiguous in the body, each sized by its own state.
+    table::validated_tx::slab valid{};
+    const auto end = from.count().value;
+    for (auto offset = zero; offset < end; offset += valid.count().value)
+    {
+        const link position{ possible_narrow_cast<link::integer>(offset) };
+        if (!from.get(position, valid))
+            return false;
+
+        if (valid.ctx.height < floor)
+            continue;
+
+        // ====================================================================
+        const auto scope = store_.get_transactor();
+
+        // Clean single allocation failure (e.g. disk full).
+        if (!to.put(from.get_key(position), valid))
+            return false;
+        // ====================================================================
+    }
+
+    return true;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -111,15 +111,24 @@ bool CLASS::set_strong(const header_link& link, size_t count,
 {
     using namespace system;
     using link_t = table::strong_tx::link;
-    using element_t = table::strong_tx::record;
 
     // Preallocate all strong_tx records for the block and reuse memory ptr.
     const auto records = possible_narrow_cast<link_t::integer>(count);
     auto record = store_.strong_tx.allocate(records);
     const auto ptr = store_.strong_tx.get_memory();
+    return set_strong(ptr, record, link, count, first_fk, positive);
+}
+
+// protected
+TEMPLATE
+bool CLASS::set_strong(const memory_ptr& ptr, strong_link& record,
+    const header_link& link, size_t count, const tx_link& first_fk,
+    bool positive) NOEXCEPT
+{
+    using element_t = table::strong_tx::record;
     const auto end = first_fk + count;
 
-    // Contiguous tx links.
+    // Contiguous tx links, record is advanced past the last written.
     for (auto fk = first_fk; fk < end; ++fk)
         if (!store_.strong_tx.put(ptr, record++, fk, element_t
             {
@@ -161,6 +170,10 @@ bool CLASS::set_unstrong(const header_link& link) NOEXCEPT
     // ========================================================================
     const auto scope = store_.get_transactor();
 
+    // Cached encodings and merkle tree of the unstrong block are released.
+    wire_cache_.erase(link.value);
+    merkle_cache_.erase(link.value);
+
     // Clean allocation failure (e.g. disk full).
     return set_strong(link, txs.number, txs.coinbase_fk, false);
     // ========================================================================
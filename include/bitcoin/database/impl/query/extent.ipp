@@ -91,13 +91,20 @@ size_t CLASS::store_body_size() const NOEXCEPT
         + candidate_body_size()
         + confirmed_body_size()
         + strong_tx_body_size()
+        + spent_body_size()
+        + subroot_body_size()
         + duplicate_body_size()
         + prevout_body_size()
+        + prevout1_body_size()
         + validated_bk_body_size()
         + validated_tx_body_size()
+        + validated_tx1_body_size()
         + address_body_size()
         + filter_bk_body_size()
-        + filter_tx_body_size();
+        + filter_tx_body_size()
+        + fee_bk_body_size()
+        + pool0_body_size()
+        + pool1_body_size();
 }
 
 TEMPLATE
@@ -120,13 +127,20 @@ size_t CLASS::store_head_size() const NOEXCEPT
         + candidate_head_size()
         + confirmed_head_size()
         + strong_tx_head_size()
+        + spent_head_size()
+        + subroot_head_size()
         + duplicate_head_size()
         + prevout_head_size()
+        + prevout1_head_size()
         + validated_bk_head_size()
         + validated_tx_head_size()
+        + validated_tx1_head_size()
         + address_head_size()
         + filter_bk_head_size()
-        + filter_tx_head_size();
+        + filter_tx_head_size()
+        + fee_bk_head_size()
+        + pool0_head_size()
+        + pool1_head_size();
 }
 
 // Sizes.
@@ -144,12 +158,19 @@ DEFINE_SIZES(tx)
 DEFINE_SIZES(candidate)
 DEFINE_SIZES(confirmed)
 DEFINE_SIZES(strong_tx)
+DEFINE_SIZES(spent)
+DEFINE_SIZES(subroot)
 DEFINE_SIZES(duplicate)
 DEFINE_SIZES(prevout)
+DEFINE_SIZES(prevout1)
 DEFINE_SIZES(validated_bk)
 DEFINE_SIZES(validated_tx)
+DEFINE_SIZES(validated_tx1)
 DEFINE_SIZES(filter_bk)
 DEFINE_SIZES(filter_tx)
+DEFINE_SIZES(fee_bk)
+DEFINE_SIZES(pool0)
+DEFINE_SIZES(pool1)
 DEFINE_SIZES(address)
 
 // Buckets (hashmap + arraymap).
@@ -163,10 +184,15 @@ DEFINE_BUCKETS(tx)
 DEFINE_BUCKETS(strong_tx)
 DEFINE_BUCKETS(duplicate)
 DEFINE_BUCKETS(prevout)
+DEFINE_BUCKETS(prevout1)
 DEFINE_BUCKETS(validated_bk)
 DEFINE_BUCKETS(validated_tx)
+DEFINE_BUCKETS(validated_tx1)
 DEFINE_BUCKETS(filter_bk)
 DEFINE_BUCKETS(filter_tx)
+DEFINE_BUCKETS(fee_bk)
+DEFINE_BUCKETS(pool0)
+DEFINE_BUCKETS(pool1)
 DEFINE_BUCKETS(address)
 
 // Records (arrays).
@@ -181,8 +207,11 @@ DEFINE_RECORDS(tx)
 DEFINE_RECORDS(candidate)
 DEFINE_RECORDS(confirmed)
 DEFINE_RECORDS(strong_tx)
+DEFINE_RECORDS(spent)
+DEFINE_RECORDS(subroot)
 DEFINE_RECORDS(duplicate)
 DEFINE_RECORDS(filter_bk)
+DEFINE_RECORDS(fee_bk)
 DEFINE_RECORDS(address)
 
 // Counters (archive slabs).
@@ -255,6 +284,18 @@ bool CLASS::filter_enabled() const NOEXCEPT
     return store_.filter_bk.enabled() && store_.filter_tx.enabled();
 }
 
+TEMPLATE
+bool CLASS::fee_enabled() const NOEXCEPT
+{
+    return store_.fee_bk.enabled();
+}
+
+TEMPLATE
+bool CLASS::pool_enabled() const NOEXCEPT
+{
+    return store_.pool0.enabled() && store_.pool1.enabled();
+}
+
 } // namespace database
 } // namespace libbitcoin
 
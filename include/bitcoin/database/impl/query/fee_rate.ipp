@@ -103,6 +103,80 @@ bool CLASS::get_branch_fees(const stopper& cancel, fee_rate_sets& out,
     return !failed;
 }
 
+// fee rate histograms
+// ----------------------------------------------------------------------------
+// server estimator
+
+TEMPLATE
+bool CLASS::get_fee_histogram(fee_histogram& out,
+    const header_link& link) const NOEXCEPT
+{
+    table::fee_bk::record fee_bk{};
+    if (!store_.fee_bk.at(to_fee_bk(link), fee_bk))
+        return false;
+
+    out = fee_bk.histogram;
+    return true;
+}
+
+TEMPLATE
+bool CLASS::get_branch_fee_histograms(fee_histograms& out, size_t start,
+    size_t count) const NOEXCEPT
+{
+    out.clear();
+    if (!fee_enabled())
+        return false;
+
+    if (is_zero(count))
+        return true;
+
+    if (system::is_add_overflow(start, sub1(count)) ||
+        (start + sub1(count) > get_top_confirmed()))
+        return false;
+
+    // One fixed size row per block, so sequential reads suffice.
+    out.resize(count);
+    for (size_t offset{}; offset < count; ++offset)
+    {
+        if (!get_fee_histogram(out.at(offset), to_confirmed(start + offset)))
+        {
+            out.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// node/confirmer
+TEMPLATE
+bool CLASS::set_fee_histogram(const header_link& link,
+    const block& block) NOEXCEPT
+{
+    if (!fee_enabled())
+        return true;
+
+    // Fees require populated prevouts, coinbase is excluded.
+    fee_histogram histogram{};
+    const auto& txs = *block.transactions_ptr();
+    if (txs.empty())
+        return false;
+
+    for (auto tx = std::next(txs.begin()); tx != txs.end(); ++tx)
+        histogram.add((*tx)->fee(), (*tx)->virtual_size());
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Clean single allocation failure (e.g. disk full).
+    return store_.fee_bk.put(to_fee_bk(link), table::fee_bk::record
+    {
+        {},
+        histogram
+    });
+    // ========================================================================
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -21,7 +21,11 @@
 
 #include <atomic>
 #include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <ranges>
+#include <shared_mutex>
+#include <thread>
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
@@ -138,6 +142,151 @@ bool CLASS::get_filter_heads(hashes& filter_heads,
     return true;
 }
 
+// confirmed range readers
+// ----------------------------------------------------------------------------
+// Rows are addressed via the confirmed index under one memory guard for each
+// of the confirmed and filter_bk bodies, and copied into a presized buffer.
+
+// node/fitler-out
+TEMPLATE
+bool CLASS::get_confirmed_filter_hashes(hashes& filter_hashes,
+    hash_digest& previous_header, size_t start, size_t count) const NOEXCEPT
+{
+    filter_hashes.resize(count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_lock interlock{ confirmed_reorganization_mutex_ };
+
+    if (is_zero(start))
+        previous_header = system::null_hash;
+    else if (!get_confirmed_filters(previous_header.data(), sub1(start), one,
+        one, true))
+        return false;
+
+    return is_zero(count) || get_confirmed_filters(
+        filter_hashes.front().data(), start, count, one, false);
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// node/fitler-out
+TEMPLATE
+bool CLASS::get_confirmed_filter_heads(hashes& filter_heads, size_t start,
+    size_t count, size_t interval) const NOEXCEPT
+{
+    filter_heads.resize(count);
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_lock interlock{ confirmed_reorganization_mutex_ };
+    return is_zero(count) || get_confirmed_filters(filter_heads.front().data(),
+        start, count, interval, true);
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// node/fitler-out
+TEMPLATE
+bool CLASS::get_wire_filter_hashes(data_chunk& out,
+    hash_digest& previous_header, size_t start, size_t count) const NOEXCEPT
+{
+    using namespace system;
+    const auto prefix = variable_size(count);
+    out.resize(prefix + count * hash_size);
+    stream::flip::fast ostream(out);
+    flip::bytes::fast sink(ostream);
+    sink.write_variable(count);
+    if (!sink)
+        return false;
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_lock interlock{ confirmed_reorganization_mutex_ };
+
+    if (is_zero(start))
+        previous_header = null_hash;
+    else if (!get_confirmed_filters(previous_header.data(), sub1(start), one,
+        one, true))
+        return false;
+
+    return get_confirmed_filters(std::next(out.data(), prefix), start, count,
+        one, false);
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// node/fitler-out
+TEMPLATE
+bool CLASS::get_wire_filter_heads(data_chunk& out, size_t start,
+    size_t count, size_t interval) const NOEXCEPT
+{
+    using namespace system;
+    const auto prefix = variable_size(count);
+    out.resize(prefix + count * hash_size);
+    stream::flip::fast ostream(out);
+    flip::bytes::fast sink(ostream);
+    sink.write_variable(count);
+    if (!sink)
+        return false;
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_lock interlock{ confirmed_reorganization_mutex_ };
+    return get_confirmed_filters(std::next(out.data(), prefix), start, count,
+        interval, true);
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+// protected
+// Caller must hold the confirmed reorganization (shared) lock.
+TEMPLATE
+bool CLASS::get_confirmed_filters(uint8_t* data, size_t start, size_t count,
+    size_t interval, bool heads) const NOEXCEPT
+{
+    using namespace system;
+    if (is_zero(count))
+        return true;
+
+    if (is_zero(interval) || is_multiply_overflow(sub1(count), interval) ||
+        is_add_overflow(start, sub1(count) * interval))
+        return false;
+
+    // Last requested height must be confirmed.
+    if (start + sub1(count) * interval >= store_.confirmed.count())
+        return false;
+
+    // Both guards are acquired before any row is read (no allocation).
+    const auto confirmed = store_.confirmed.get_memory();
+    const auto filters = store_.filter_bk.get_memory();
+    if (!confirmed || !filters)
+        return false;
+
+    using ix = table::height::link::integer;
+    for (auto height = start; is_nonzero(count); --count, height += interval)
+    {
+        table::height::record index{};
+        const auto position = possible_narrow_cast<ix>(height);
+        if (!table::height::get(confirmed, position, index))
+            return false;
+
+        // Filter index (head) is not guarded by the body memory pointer.
+        const auto link = store_.filter_bk.at(to_filter_bk(index.header_fk));
+
+        if (heads)
+        {
+            table::filter_bk::get_head_only row{};
+            if (!table::filter_bk::get(filters, link, row))
+                return false;
+
+            data = std::copy(row.head.begin(), row.head.end(), data);
+        }
+        else
+        {
+            table::filter_bk::get_hash_only row{};
+            if (!table::filter_bk::get(filters, link, row))
+                return false;
+
+            data = std::copy(row.hash.begin(), row.hash.end(), data);
+        }
+    }
+
+    return true;
+}
+
 // writers
 // ----------------------------------------------------------------------------
 
@@ -219,6 +368,105 @@ bool CLASS::set_filter_head(const header_link& link, const hash_digest& head,
     // ========================================================================
 }
 
+// backfill
+// ----------------------------------------------------------------------------
+// Filters may be enabled on a store with previously confirmed blocks. Bodies
+// are independent and computed in parallel, while heads are chained and so
+// linked sequentially. Each batch is committed before the next is started,
+// so a canceled backfill resumes above the last linked head.
+
+TEMPLATE
+code CLASS::backfill_filters(const stopper& cancel, size_t batch,
+    const std::chrono::milliseconds& pause) NOEXCEPT
+{
+    using namespace system::neutrino;
+    if (!filter_enabled())
+        return error::success;
+
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+    batch = std::max(one, batch);
+
+    for (auto first = get_first_unfiltered();;)
+    {
+        if (cancel.load(relaxed))
+            return error::canceled;
+
+        // Top is reread for each batch, as confirmation may proceed.
+        const auto top = get_top_confirmed();
+        if (first > top)
+            return error::success;
+
+        header_links links{};
+        links.reserve(std::min(batch, add1(top - first)));
+        for (auto height = first; height <= top && links.size() < batch;
+            ++height)
+        {
+            // Terminal implies concurrent reorganization, retried next batch.
+            const auto link = to_confirmed(height);
+            if (link.is_terminal())
+                break;
+
+            links.push_back(link);
+        }
+
+        if (links.empty())
+            return error::success;
+
+        stopper fail{};
+        std::for_each(parallel, links.cbegin(), links.cend(),
+            [&](const auto& link) NOEXCEPT
+            {
+                if (cancel.load(relaxed) || fail.load(relaxed) ||
+                    is_filtered_body(link))
+                    return;
+
+                // Prevout scripts are required for the filter.
+                filter body{};
+                const auto block = get_block(link, false);
+                if (!block || !populate_without_metadata(*block) ||
+                    !compute_filter(body, *block) ||
+                    !set_filter_body(link, body))
+                    fail.store(true, relaxed);
+            });
+
+        if (fail.load(relaxed))
+            return error::integrity;
+
+        if (cancel.load(relaxed))
+            return error::canceled;
+
+        for (const auto& link: links)
+            if (!set_filter_head(link))
+                return error::integrity;
+
+        first += links.size();
+
+        // Yield to foreground (e.g. validation) between batches.
+        if (is_nonzero(pause.count()))
+            std::this_thread::sleep_for(pause);
+    }
+}
+
+// protected
+TEMPLATE
+size_t CLASS::get_first_unfiltered() const NOEXCEPT
+{
+    // Each head is chained to its parent's head, so filtered heads are a
+    // contiguous prefix of the confirmed chain and can be bisected.
+    size_t lower{}, upper{ add1(get_top_confirmed()) };
+    while (lower < upper)
+    {
+        const auto middle = lower + to_half(upper - lower);
+        if (is_filtered_head(to_confirmed(middle)))
+            lower = add1(middle);
+        else
+            upper = middle;
+    }
+
+    return lower;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -81,6 +81,9 @@ bool CLASS::push_confirmed(const header_link& link, bool strong) NOEXCEPT
     if (!store_.confirmed.reserve(one))
         return false;
 
+    const auto spent = to_block_spent_outs(link);
+    const auto height = store_.confirmed.count();
+
     // ========================================================================
     const auto scope = store_.get_transactor();
 
@@ -88,6 +91,13 @@ bool CLASS::push_confirmed(const header_link& link, bool strong) NOEXCEPT
     if (strong && !set_strong(link, txs.number, txs.coinbase_fk, true))
         return false;
 
+    if (!set_spent(spent, true))
+        return false;
+
+    // Extends the subroot cache if this block completes an interval.
+    if (!push_subroot(link, height))
+        return false;
+
     const table::height::record confirmed{ {}, link };
     return store_.confirmed.commit(confirmed);
     // ========================================================================
@@ -106,6 +116,8 @@ bool CLASS::pop_confirmed() NOEXCEPT
     if (!store_.txs.at(to_txs(link), txs))
         return {};
 
+    const auto spent = to_block_spent_outs(link);
+
     // ========================================================================
     const auto scope = store_.get_transactor();
 
@@ -113,6 +125,18 @@ bool CLASS::pop_confirmed() NOEXCEPT
     if (!set_strong(link, txs.number, txs.coinbase_fk, false))
         return false;
 
+    // No allocation (bits are only cleared).
+    if (!set_spent(spent, false))
+        return false;
+
+    // No allocation (nodes are only truncated).
+    if (!pop_subroot(top))
+        return false;
+
+    // Cached encodings and merkle tree of the popped block are released.
+    wire_cache_.erase(link.value);
+    merkle_cache_.erase(link.value);
+
     ///////////////////////////////////////////////////////////////////////////
     std::unique_lock interlock{ confirmed_reorganization_mutex_ };
     return store_.confirmed.truncate(top);
@@ -120,6 +144,192 @@ bool CLASS::pop_confirmed() NOEXCEPT
     // ========================================================================
 }
 
+// range writers
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::push_candidate(const header_links& links) NOEXCEPT
+{
+    using namespace system;
+    if (links.empty())
+        return true;
+
+    if (std::any_of(links.cbegin(), links.cend(), [](const auto& link) NOEXCEPT
+        { return link == header_link::terminal; }))
+        return false;
+
+    // Reserve-commit for deferred access, all heights as one contiguous write.
+    const auto count = possible_narrow_cast<height_link::integer>(links.size());
+    if (!store_.candidate.reserve(count))
+        return false;
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Clean single allocation failure (e.g. disk full).
+    return store_.candidate.commit(table::height::put_refs{ {}, links });
+    // ========================================================================
+}
+
+TEMPLATE
+bool CLASS::pop_candidate(size_t count) NOEXCEPT
+{
+    using namespace system;
+    const auto top = get_top_candidate();
+    if (is_zero(count))
+        return true;
+
+    // Genesis is never popped.
+    if (count > top)
+        return false;
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Candidate pop implies reorg or disorg, which implies future duplicates.
+    store_.set_dirty();
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock interlock{ candidate_reorganization_mutex_ };
+    return store_.candidate.truncate(
+        possible_narrow_cast<height_link::integer>(add1(top - count)));
+    ///////////////////////////////////////////////////////////////////////////
+    // ========================================================================
+}
+
+TEMPLATE
+bool CLASS::push_confirmed(const header_links& links, bool strong) NOEXCEPT
+{
+    using namespace system;
+    if (links.empty())
+        return true;
+
+    // Blocks are read before the transaction, as in the single height case.
+    auto records = zero;
+    outs_links spent{};
+    const auto count = links.size();
+    std::vector<table::txs::get_coinbase_and_count> sets(count);
+    for (auto index = zero; index < count; ++index)
+    {
+        const header_link link{ links.at(index) };
+        if (link.is_terminal())
+            return false;
+
+        if (strong && !store_.txs.at(to_txs(link), sets.at(index)))
+            return false;
+
+        const auto outs = to_block_spent_outs(link);
+        spent.insert(spent.end(), outs.cbegin(), outs.cend());
+        records += sets.at(index).number;
+    }
+
+    // Reserve-commit to ensure disk full safety and deferred access.
+    if (!store_.confirmed.reserve(
+        possible_narrow_cast<height_link::integer>(count)))
+        return false;
+
+    const auto height = store_.confirmed.count().value;
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // All strong_tx records of the range are allocated at once.
+    if (strong)
+    {
+        auto record = store_.strong_tx.allocate(
+            possible_narrow_cast<strong_link::integer>(records));
+        const auto ptr = store_.strong_tx.get_memory();
+        for (auto index = zero; index < count; ++index)
+        {
+            const auto& txs = sets.at(index);
+            if (!set_strong(ptr, record, links.at(index), txs.number,
+                txs.coinbase_fk, true))
+                return false;
+        }
+    }
+
+    // Bitmap is expanded once for the range.
+    if (!set_spent(spent, true))
+        return false;
+
+    for (auto index = zero; index < count; ++index)
+        if (!push_subroot(links.at(index), height + index))
+            return false;
+
+    return store_.confirmed.commit(table::height::put_refs{ {}, links });
+    // ========================================================================
+}
+
+TEMPLATE
+bool CLASS::pop_confirmed(size_t count) NOEXCEPT
+{
+    using namespace system;
+    const auto top = get_top_confirmed();
+    if (is_zero(count))
+        return true;
+
+    // Genesis is never popped.
+    if (count > top)
+        return false;
+
+    // Blocks are read top down, before the transaction.
+    auto records = zero;
+    outs_links spent{};
+    header_links links(count);
+    std::vector<table::txs::get_coinbase_and_count> sets(count);
+    for (auto index = zero; index < count; ++index)
+    {
+        const auto link = to_confirmed(top - index);
+        if (!store_.txs.at(to_txs(link), sets.at(index)))
+            return false;
+
+        const auto outs = to_block_spent_outs(link);
+        spent.insert(spent.end(), outs.cbegin(), outs.cend());
+        records += sets.at(index).number;
+        links.at(index) = link;
+    }
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Clean single allocation failure, all records allocated at once.
+    {
+        auto record = store_.strong_tx.allocate(
+            possible_narrow_cast<strong_link::integer>(records));
+        const auto ptr = store_.strong_tx.get_memory();
+        for (auto index = zero; index < count; ++index)
+        {
+            const auto& txs = sets.at(index);
+            if (!set_strong(ptr, record, links.at(index), txs.number,
+                txs.coinbase_fk, false))
+                return false;
+        }
+    }
+
+    // No allocation (bits are only cleared).
+    if (!set_spent(spent, false))
+        return false;
+
+    // No allocation (nodes are only truncated).
+    for (auto index = zero; index < count; ++index)
+        if (!pop_subroot(top - index))
+            return false;
+
+    // Cached encodings and merkle trees of the popped blocks are released.
+    for (const auto& link: links)
+    {
+        wire_cache_.erase(link);
+        merkle_cache_.erase(link);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock interlock{ confirmed_reorganization_mutex_ };
+    return store_.confirmed.truncate(
+        possible_narrow_cast<height_link::integer>(add1(top - count)));
+    ///////////////////////////////////////////////////////////////////////////
+    // ========================================================================
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -208,6 +208,7 @@ bool CLASS::initialize(const block& genesis) NOEXCEPT
     // Unsafe for allocation failure, but only used in store creation.
     return set_filter_body(link, genesis)
         && set_filter_head(link)
+        && set_fee_histogram(link, genesis)
         && push_candidate(link)
         && push_confirmed(link, true);
     // ========================================================================
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_DATABASE_QUERY_LOCATOR_IPP
 
 #include <algorithm>
+#include <shared_mutex>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -75,10 +76,88 @@ hashes CLASS::get_blocks(const hashes& locator,
     return out;
 }
 
+// node/header-out
+// server/electrum
+TEMPLATE
+bool CLASS::get_wire_headers(bytewriter& sink, const hashes& locator,
+    const hash_digest& stop, size_t limit) const NOEXCEPT
+{
+    return get_wire_headers(sink, get_locator_span(locator, stop, limit));
+}
+
+// node/header-out
+// server/electrum
+TEMPLATE
+data_chunk CLASS::get_wire_headers(const hashes& locator,
+    const hash_digest& stop, size_t limit) const NOEXCEPT
+{
+    using namespace system;
+    const auto span = get_locator_span(locator, stop, limit);
+    data_chunk data(span.size() * chain::header::serialized_size());
+
+    stream::flip::fast ostream(data);
+    flip::bytes::fast out(ostream);
+    if (!get_wire_headers(out, span) || !out)
+        return {};
+
+    return data;
+}
+
 // utilities
 // ----------------------------------------------------------------------------
 // protected
 
+TEMPLATE
+bool CLASS::get_wire_headers(bytewriter& sink, const span& range) const NOEXCEPT
+{
+    using namespace system;
+    using ix = table::height::link::integer;
+    if (is_zero(range.size()))
+        return true;
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::shared_lock interlock{ confirmed_reorganization_mutex_ };
+
+    // Span end above confirmed top implies intervening reorganization.
+    if (range.end > store_.confirmed.count())
+        return false;
+
+    // Rows are read under one guard each for the confirmed and header bodies.
+    const auto confirmed = store_.confirmed.get_memory();
+    const auto headers = store_.header.get_memory();
+    if (!confirmed || !headers)
+        return false;
+
+    // The first parent is resolved via the confirmed index, and thereafter is
+    // the key of the preceding row (no parent header row read as to_parent).
+    table::height::record index{};
+    hash_digest parent{ null_hash };
+    if (is_nonzero(range.begin))
+    {
+        const auto previous = possible_narrow_cast<ix>(sub1(range.begin));
+        if (!table::height::get(confirmed, previous, index))
+            return false;
+
+        parent = table::header::get_key(headers, index.header_fk);
+    }
+
+    for (auto height = range.begin; height < range.end; ++height)
+    {
+        const auto position = possible_narrow_cast<ix>(height);
+        if (!table::height::get(confirmed, position, index))
+            return false;
+
+        table::header::wire_header header{ {}, sink, parent };
+        if (!table::header::get(headers, index.header_fk, header))
+            return false;
+
+        parent = table::header::get_key(headers, index.header_fk);
+    }
+
+    return sink;
+    ///////////////////////////////////////////////////////////////////////////
+}
+
 TEMPLATE
 span CLASS::get_locator_span(const hashes& locator, const hash_digest& stop,
     size_t limit) const NOEXCEPT
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
@@ -41,6 +42,9 @@ code CLASS::get_merkle_root_and_proof(hash_digest& root, hashes& proof,
     if (waypoint > get_top_confirmed())
         return error::not_found;
 
+    if (is_subroot_cached(waypoint))
+        return get_merkle_cached(root, proof, target, waypoint);
+
     hashes roots{};
     if (const auto ec = get_merkle_subroots(roots, waypoint))
         return ec;
@@ -55,6 +59,13 @@ code CLASS::get_merkle_root_and_proof(hash_digest& root, hashes& proof,
 TEMPLATE
 hash_digest CLASS::get_merkle_root(size_t height) const NOEXCEPT
 {
+    if (is_subroot_cached(height))
+    {
+        hash_digest root{}, last{};
+        return get_merkle_cached_root(root, last, height) ? hash_digest{} :
+            root;
+    }
+
     hashes roots{};
     if (const auto ec = get_merkle_subroots(roots, height))
         return {};
@@ -62,9 +73,129 @@ hash_digest CLASS::get_merkle_root(size_t height) const NOEXCEPT
     return system::merkle_root(std::move(roots));
 }
 
+// block tx branches
+// ----------------------------------------------------------------------------
+// Block trees are cached by header link and released when the block is popped
+// or set unstrong, so a cached tree always reflects the current association.
+
+TEMPLATE
+bool CLASS::get_tx_merkle_branch(hashes& out, size_t& position,
+    const tx_link& link) const NOEXCEPT
+{
+    using namespace system;
+    const auto block = find_strong(link);
+    if (block.is_terminal() || !get_tx_position(position, link, block))
+        return false;
+
+    const auto leaves = get_tx_count(block);
+    const auto tree = get_merkle_tree(block);
+    if (!tree || position >= leaves ||
+        tree->size() != merkle_tree_size(leaves) * hash_size)
+        return false;
+
+    // Tree is its levels concatenated from leaves to root. An odd level pairs
+    // its last node with itself, so that node is its own sibling.
+    out.clear();
+    out.reserve(ceilinged_log2(leaves));
+    auto index = position;
+    for (auto offset = zero, width = leaves; width > one;
+        offset += width, width = add1(width) / two)
+    {
+        const auto sibling = std::min(bit_xor(index, one), sub1(width));
+        const auto start = std::next(tree->begin(), (offset + sibling) *
+            hash_size);
+
+        hash_digest hash{};
+        std::copy_n(start, hash_size, hash.begin());
+        out.push_back(std::move(hash));
+        shift_right_into(index);
+    }
+
+    return true;
+}
+
+TEMPLATE
+wire_cache::metrics CLASS::get_merkle_cache_metrics() const NOEXCEPT
+{
+    return merkle_cache_.get_metrics();
+}
+
+// protected
+TEMPLATE
+wire_cache::chunk_cptr CLASS::get_merkle_tree(
+    const header_link& link) const NOEXCEPT
+{
+    using namespace system;
+    constexpr auto type = wire_cache::kind::merkle_tree;
+    if (auto tree = merkle_cache_.get(link.value, type))
+        return tree;
+
+    const auto tx_fks = to_transactions(link);
+    const auto leaves = tx_fks.size();
+    if (is_zero(leaves))
+        return {};
+
+    // Small blocks are not worth the scheduling overhead.
+    constexpr size_t parallel_leaves = 1024;
+    const auto policy = poolstl::execution::par_if(leaves >= parallel_leaves);
+
+    hashes nodes(merkle_tree_size(leaves));
+    std::transform(policy, tx_fks.begin(), tx_fks.end(), nodes.begin(),
+        [&](const tx_link& tx_fk) NOEXCEPT
+        {
+            return get_tx_key(tx_fk);
+        });
+
+    // Return of any null_hash implies failure.
+    if (std::any_of(nodes.begin(), std::next(nodes.begin(), leaves),
+        [](const hash_digest& hash) NOEXCEPT { return hash == null_hash; }))
+        return {};
+
+    // Each level is hashed in parallel from the one below it.
+    std::vector<size_t> rows(add1(leaves) / two);
+    std::iota(rows.begin(), rows.end(), zero);
+    for (auto offset = zero, width = leaves; width > one;
+        offset += width, width = add1(width) / two)
+    {
+        const auto next = offset + width;
+        const auto last = sub1(next);
+        const auto end = std::next(rows.begin(), add1(width) / two);
+        std::for_each(policy, rows.begin(), end, [&](size_t row) NOEXCEPT
+        {
+            const auto left = offset + two * row;
+            nodes.at(next + row) = sha256::double_hash(nodes.at(left),
+                nodes.at(std::min(add1(left), last)));
+        });
+    }
+
+    data_chunk data(nodes.size() * hash_size);
+    auto it = data.begin();
+    for (const auto& node: nodes)
+        it = std::copy(node.begin(), node.end(), it);
+
+    const auto out = to_shared<const data_chunk>(std::move(data));
+    merkle_cache_.put(link.value, type, out);
+    return out;
+}
+
 // utilities
 // ----------------------------------------------------------------------------
 
+// static/protected
+TEMPLATE
+size_t CLASS::merkle_tree_size(size_t leaves) NOEXCEPT
+{
+    if (is_zero(leaves))
+        return zero;
+
+    // Sum of level widths, including the root.
+    auto size = leaves;
+    for (auto width = leaves; width > one; size += width)
+        width = add1(width) / two;
+
+    return size;
+}
+
 // static/protected
 TEMPLATE
 positions CLASS::merkle_branch(size_t leaf, size_t leaves,
@@ -179,6 +310,24 @@ code CLASS::get_merkle_proof(hashes& proof, hashes roots, size_t target,
     const auto span = interval_span();
     BC_ASSERT(!is_zero(span));
 
+    using namespace system;
+    proof.clear();
+    proof.reserve(ceilinged_log2(span) + ceilinged_log2(roots.size()));
+    if (const auto ec = get_merkle_interval_proof(proof, target, waypoint))
+        return ec;
+
+    merge_merkle(proof, std::move(roots), target / span, zero);
+    return error::success;
+}
+
+// protected
+TEMPLATE
+code CLASS::get_merkle_interval_proof(hashes& proof, size_t target,
+    size_t waypoint) const NOEXCEPT
+{
+    const auto span = interval_span();
+    BC_ASSERT(!is_zero(span));
+
     const auto first = (target / span) * span;
     const auto close = sub1(first + span);
     const auto last  = std::min(waypoint, close);
@@ -190,12 +339,7 @@ code CLASS::get_merkle_proof(hashes& proof, hashes roots, size_t target,
     const auto count = parts.size();
     const auto pad   = to_int<size_t>(!is_one(count) && is_odd(count));
     const auto lift  = is_zero(first) ? zero : (span - (count + pad));
-
-    using namespace system;
-    proof.clear();
-    proof.reserve(ceilinged_log2(parts.size()) + ceilinged_log2(roots.size()));
     merge_merkle(proof, std::move(parts), target % span, lift);
-    merge_merkle(proof, std::move(roots), target / span, zero);
     return error::success;
 }
 
@@ -250,31 +394,290 @@ code CLASS::get_merkle_subroots(hashes& roots, size_t waypoint) const NOEXCEPT
     // Either all subroots elevated to same level, or there is a single root.
     for (size_t first{}; first < leafs; first += span)
     {
-        const auto last = std::min(sub1(first + span), waypoint);
-        const auto size = add1(last - first);
+        hash_digest root{};
+        if (const auto ec = get_merkle_subroot(root, first, waypoint))
+            return ec;
 
-        if (size == span)
-        {
-            auto interval = get_confirmed_interval(last);
-            if (!interval.has_value()) return error::merkle_interval;
-            roots.push_back(std::move(interval.value()));
-        }
-        else if (is_zero(first))
-        {
-            // Single hash, is the complete merkle root.
-            auto complete = get_confirmed_hashes(zero, size);
-            roots.push_back(merkle_root(std::move(complete)));
-        }
-        else
-        {
-            // Roots is even-size-except-one-reserved for merkle root push.
-            auto partial = get_confirmed_hashes(first, size);
-            if (partial.empty()) return error::merkle_hashes;
-            roots.push_back(partial_subroot(std::move(partial), span));
-        }
+        roots.push_back(std::move(root));
+    }
+
+    return error::success;
+}
+
+// protected
+TEMPLATE
+code CLASS::get_merkle_subroot(hash_digest& root, size_t first,
+    size_t waypoint) const NOEXCEPT
+{
+    const auto span = interval_span();
+    BC_ASSERT(!is_zero(span));
+
+    using namespace system;
+    const auto last = std::min(sub1(first + span), waypoint);
+    const auto size = add1(last - first);
+
+    if (size == span)
+    {
+        auto interval = get_confirmed_interval(last);
+        if (!interval.has_value()) return error::merkle_interval;
+        root = std::move(interval.value());
+    }
+    else if (is_zero(first))
+    {
+        // Single hash, is the complete merkle root.
+        auto complete = get_confirmed_hashes(zero, size);
+        root = merkle_root(std::move(complete));
+    }
+    else
+    {
+        // Elevated to the level of complete interval roots.
+        auto partial = get_confirmed_hashes(first, size);
+        if (partial.empty()) return error::merkle_hashes;
+        root = partial_subroot(std::move(partial), span);
+    }
+
+    return error::success;
+}
+
+// subroot cache
+// ----------------------------------------------------------------------------
+// Complete intervals are cached as a merkle mountain range (see table), so a
+// root or proof reads O(log n) nodes instead of all interval roots. The cache
+// is extended by push_confirmed, and by rebuild_subroot() for intervals that
+// were confirmed before it existed.
+
+TEMPLATE
+code CLASS::rebuild_subroot(const stopper& cancel) NOEXCEPT
+{
+    using namespace system;
+    const auto span = interval_span();
+    BC_ASSERT(!is_zero(span));
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Nothing to rebuild if the cache covers all complete intervals.
+    const auto intervals = store_.confirmed.count().value / span;
+    if (store_.subroot.count() == table::subroot::to_nodes(intervals))
+        return error::success;
+
+    if (!store_.subroot.truncate(subroot_link::integer{}))
+        return error::integrity;
+
+    for (auto index = zero; index < intervals; ++index)
+    {
+        if (cancel.load(std::memory_order_relaxed))
+            return error::canceled;
+
+        const auto height = sub1(add1(index) * span);
+        if (!push_subroot(to_confirmed(height), height))
+            return error::integrity;
+
+        // An interval without an archived root ends the cache.
+        if (store_.subroot.count() != table::subroot::to_nodes(add1(index)))
+            break;
     }
 
     return error::success;
+    // ========================================================================
+}
+
+// protected
+TEMPLATE
+bool CLASS::is_subroot_cached(size_t waypoint) const NOEXCEPT
+{
+    const auto span = interval_span();
+    BC_ASSERT(!is_zero(span));
+
+    // Cache is usable only if it covers all complete intervals to waypoint.
+    const auto complete = add1(waypoint) / span;
+    return store_.subroot.count() >= table::subroot::to_nodes(complete);
+}
+
+// protected
+TEMPLATE
+code CLASS::get_merkle_cached(hash_digest& root, hashes& proof, size_t target,
+    size_t waypoint) const NOEXCEPT
+{
+    hash_digest last{};
+    if (const auto ec = get_merkle_cached_root(root, last, waypoint))
+        return ec;
+
+    const auto span = interval_span();
+    BC_ASSERT(!is_zero(span));
+
+    // Interval portion of the proof is computed from block hashes.
+    proof.clear();
+    if (const auto ec = get_merkle_interval_proof(proof, target, waypoint))
+        return ec;
+
+    using namespace system;
+    const auto leafs = add1(waypoint);
+    const auto complete = leafs / span;
+    const auto count = ceilinged_divide(leafs, span);
+
+    // Roots portion of the proof is read from (or derived via) the cache.
+    const auto size = count + to_int<size_t>(!is_one(count) && is_odd(count));
+    auto level = zero;
+    for (const auto& row: merkle_branch(target / span, size))
+    {
+        hash_digest node{};
+        if (const auto ec = get_merkle_node(node, level++, row.sibling,
+            complete, count, last))
+            return ec;
+
+        proof.push_back(std::move(node));
+    }
+
+    return error::success;
+}
+
+// protected
+TEMPLATE
+code CLASS::get_merkle_cached_root(hash_digest& root, hash_digest& last,
+    size_t waypoint) const NOEXCEPT
+{
+    const auto span = interval_span();
+    BC_ASSERT(!is_zero(span));
+
+    using namespace system;
+    const auto leafs = add1(waypoint);
+    const auto complete = leafs / span;
+    const auto count = ceilinged_divide(leafs, span);
+    const auto first = sub1(count) * span;
+
+    // The last root is the only one that may require computation (partial).
+    if (complete == count)
+    {
+        table::subroot::record node{};
+        if (!store_.subroot.get(table::subroot::to_node(zero, sub1(count)),
+            node))
+            return error::merkle_interval;
+
+        last = node.hash;
+    }
+    else if (const auto ec = get_merkle_subroot(last, first, waypoint))
+    {
+        return ec;
+    }
+
+    if (is_one(count))
+    {
+        root = last;
+        return error::success;
+    }
+
+    return get_merkle_node(root, ceilinged_log2(count), zero, complete, count,
+        last);
+}
+
+// protected
+TEMPLATE
+code CLASS::get_merkle_node(hash_digest& out, size_t level, size_t index,
+    size_t complete, size_t count, const hash_digest& last) const NOEXCEPT
+{
+    using namespace system;
+    const auto width = power2(level);
+    const auto first = index * width;
+
+    // Padding beyond the last root elevates the last root (see merge_merkle).
+    if (first >= count)
+    {
+        out = partial_subroot({ last }, width);
+        return error::success;
+    }
+
+    // Nodes covering only complete intervals are cached.
+    if (first + width <= complete)
+    {
+        table::subroot::record node{};
+        if (!store_.subroot.get(table::subroot::to_node(level, index), node))
+            return error::merkle_interval;
+
+        out = node.hash;
+        return error::success;
+    }
+
+    // Incomplete leaf is the last root.
+    if (is_zero(level))
+    {
+        out = last;
+        return error::success;
+    }
+
+    // Incomplete node is derived from its children, duplicating an odd one.
+    hash_digest left{};
+    const auto child = index + index;
+    if (const auto ec = get_merkle_node(left, sub1(level), child, complete,
+        count, last))
+        return ec;
+
+    hash_digest right{ left };
+    if (first + to_half(width) < count)
+    {
+        if (const auto ec = get_merkle_node(right, sub1(level), add1(child),
+            complete, count, last))
+            return ec;
+    }
+
+    out = sha256::double_hash(left, right);
+    return error::success;
+}
+
+// protected
+TEMPLATE
+bool CLASS::push_subroot(const header_link& link, size_t height) NOEXCEPT
+{
+    const auto span = interval_span();
+    BC_ASSERT(!is_zero(span));
+
+    using namespace system;
+    if (!is_multiple(add1(height), span))
+        return true;
+
+    // Cache is extended only when it is in sync with confirmed intervals.
+    const auto index = sub1(add1(height) / span);
+    if (store_.subroot.count() != table::subroot::to_nodes(index))
+        return true;
+
+    table::txs::get_interval txs{};
+    if (!store_.txs.at(to_txs(link), txs) || !txs.interval.has_value())
+        return true;
+
+    // Append the interval root and then each parent node that it completes.
+    auto hash = txs.interval.value();
+    if (!store_.subroot.put(table::subroot::record{ {}, hash }))
+        return false;
+
+    for (auto level = zero; is_odd(index >> level); ++level)
+    {
+        table::subroot::record left{};
+        const auto sibling = sub1(index >> level);
+        if (!store_.subroot.get(table::subroot::to_node(level, sibling), left))
+            return false;
+
+        hash = sha256::double_hash(left.hash, hash);
+        if (!store_.subroot.put(table::subroot::record{ {}, hash }))
+            return false;
+    }
+
+    return true;
+}
+
+// protected
+TEMPLATE
+bool CLASS::pop_subroot(size_t height) NOEXCEPT
+{
+    const auto span = interval_span();
+    BC_ASSERT(!is_zero(span));
+
+    if (!system::is_multiple(add1(height), span))
+        return true;
+
+    // Truncate to the nodes of the intervals that precede this one.
+    const auto index = sub1(add1(height) / span);
+    const auto nodes = table::subroot::to_nodes(index);
+    return store_.subroot.count() <= nodes || store_.subroot.truncate(nodes);
 }
 
 } // namespace database
@@ -48,6 +48,13 @@ constexpr size_t CLASS::to_filter_tx(const header_link& link) const NOEXCEPT
     return link.is_terminal() ? table::filter_tx::link::terminal : link.value;
 }
 
+TEMPLATE
+constexpr size_t CLASS::to_fee_bk(const header_link& link) const NOEXCEPT
+{
+    static_assert(header_link::terminal <= table::fee_bk::link::terminal);
+    return link.is_terminal() ? table::fee_bk::link::terminal : link.value;
+}
+
 TEMPLATE
 constexpr size_t CLASS::to_prevout(const header_link& link) const NOEXCEPT
 {
@@ -68,6 +68,10 @@ inline header_link CLASS::to_header(const hash_digest& key) const NOEXCEPT
 TEMPLATE
 inline tx_link CLASS::to_tx(const hash_digest& key) const NOEXCEPT
 {
+    // Bypass hashmap search when key is screened out by the filter.
+    if (!store_.tx_bloom.contains(key))
+        return {};
+
     return store_.tx.first(key);
 }
 
@@ -197,6 +197,9 @@ TEMPLATE
 tx_links CLASS::to_duplicates(const hash_digest& tx_hash) const NOEXCEPT
 {
     tx_links out{};
+    if (!store_.tx_bloom.contains(tx_hash))
+        return out;
+
     for (auto it = store_.tx.it(tx_hash); it; ++it)
         out.push_back(*it);
 
@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_QUERY_POOL_IPP
+#define LIBBITCOIN_DATABASE_QUERY_POOL_IPP
+
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// Pool (unconfirmed txs).
+// ----------------------------------------------------------------------------
+// Relayed txs that never confirm are not archived, so they neither grow the
+// archive nor lengthen its conflict lists. Each generation is a slab hashmap
+// of wire encoded txs, emptied in place upon rotation. The pool mutex
+// excludes reads and writes from the truncation of a generation.
+
+TEMPLATE
+bool CLASS::is_pooled(const hash_digest& key) const NOEXCEPT
+{
+    if (!pool_enabled())
+        return false;
+
+    std::shared_lock lock{ pool_mutex_ };
+    const auto generation = store_.pool_generation();
+    return to_pool(generation).exists(key) || (store_.is_prior_readable() &&
+        to_pool(add1(generation)).exists(key));
+}
+
+TEMPLATE
+typename CLASS::transaction::cptr CLASS::get_pooled_transaction(
+    const hash_digest& key) const NOEXCEPT
+{
+    if (!pool_enabled())
+        return {};
+
+    std::shared_lock lock{ pool_mutex_ };
+    const auto generation = store_.pool_generation();
+
+    table::pool::get_tx pooled{};
+    if (to_pool(generation).find(key, pooled) || (store_.is_prior_readable() &&
+        to_pool(add1(generation)).find(key, pooled)))
+        return pooled.tx;
+
+    return {};
+}
+
+TEMPLATE
+bool CLASS::set_pooled(const transaction& tx) NOEXCEPT
+{
+    if (!pool_enabled() || tx.is_empty())
+        return false;
+
+    // Size based eviction, a concurrent rotation of the same generation wins.
+    const auto limit = store_.pool_limit();
+    const auto generation = store_.pool_generation();
+    if (is_nonzero(limit) && to_pool(generation).body_size() >= limit &&
+        !rotate_pool(generation))
+        return false;
+
+    // tx.get_hash() assumes cached or is not thread safe.
+    const auto& key = tx.get_hash(false);
+
+    std::shared_lock lock{ pool_mutex_ };
+    const auto current = store_.pool_generation();
+
+    // Inserts are serialized so that a key cannot be inserted twice.
+    std::unique_lock insert{ pool_insert_mutex_ };
+    if (to_pool(current).exists(key) || to_pool(add1(current)).exists(key))
+        return true;
+
+    table::pool::link link{};
+    {
+        // ====================================================================
+        const auto scope = store_.get_transactor();
+
+        // Clean single allocation failure (e.g. disk full).
+        link = to_pool(current).put_link(key, table::pool::put_ref{ {}, tx });
+        // ====================================================================
+    }
+
+    if (link.is_terminal())
+        return false;
+
+    // tx.get_hash() assumes cached or is not thread safe.
+    if (short_ids_.enabled())
+        short_ids_.push(to_pooled_reference(current, link), tx.get_hash(true));
+
+    return true;
+}
+
+TEMPLATE
+bool CLASS::rotate_pool() NOEXCEPT
+{
+    return !pool_enabled() || rotate_pool(store_.pool_generation());
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+table::pool& CLASS::to_pool(size_t generation) const NOEXCEPT
+{
+    return system::is_odd(generation) ? store_.pool1 : store_.pool0;
+}
+
+// Short id references to pooled txs are flagged pool links with the low bits
+// of their generation (between flag and link). A rotation reuses the links of
+// the emptied generation, so only references of the current or prior
+// generation are read, and a tx read by reference is matched to the short id
+// before it is returned.
+
+TEMPLATE
+uint64_t CLASS::to_pooled_reference(size_t generation,
+    const table::pool::link& link) NOEXCEPT
+{
+    return pooled_flag | ((generation & pooled_generations) << pooled_shift) |
+        link.value;
+}
+
+TEMPLATE
+bool CLASS::is_pooled_reference(uint64_t reference) NOEXCEPT
+{
+    return to_bool(reference & pooled_flag);
+}
+
+TEMPLATE
+typename CLASS::transaction::cptr CLASS::get_pooled_reference(
+    uint64_t reference) const NOEXCEPT
+{
+    using namespace system;
+    constexpr auto mask = unmask_right<uint64_t>(table::pool::link::bits);
+    const auto current = store_.pool_generation() & pooled_generations;
+    const auto generation = (reference >> pooled_shift) & pooled_generations;
+
+    // Older generations have been emptied, and their links may be reused. A
+    // follower reads only the current, as the writer may reset the prior.
+    if (generation != current && (!store_.is_prior_readable() ||
+        generation != (sub1(current) & pooled_generations)))
+        return {};
+
+    table::pool::get_tx pooled{};
+    const table::pool::link link{ possible_narrow_cast<
+        table::pool::link::integer>(reference & mask) };
+    return to_pool(generation).get(link, pooled) ? pooled.tx :
+        transaction::cptr{};
+}
+
+TEMPLATE
+bool CLASS::rotate_pool(size_t generation) NOEXCEPT
+{
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_lock lock{ pool_mutex_ };
+    if (store_.pool_generation() != generation)
+        return true;
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // The prior generation is emptied and becomes current.
+    if (!to_pool(add1(generation)).reset())
+        return false;
+
+    store_.set_pool_generation(add1(generation));
+    return true;
+    // ========================================================================
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
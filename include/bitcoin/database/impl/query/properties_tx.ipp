@@ -30,7 +30,8 @@ namespace database {
 TEMPLATE
 inline bool CLASS::is_tx(const hash_digest& key) const NOEXCEPT
 {
-    return store_.tx.exists(key);
+    // Bypass hashmap search when key is screened out by the filter.
+    return store_.tx_bloom.contains(key) && store_.tx.exists(key);
 }
 
 TEMPLATE
@@ -69,7 +69,10 @@ namespace database {
 
 TEMPLATE
 CLASS::query(Store& store) NOEXCEPT
-  : store_(store)
+  : wire_cache_(store.wire_cache_limit()),
+    merkle_cache_(store.merkle_cache_limit()),
+    short_ids_(store.short_id_limit()),
+    store_(store)
 {
 }
 
@@ -170,6 +173,13 @@ size_t CLASS::negative_search_count() const NOEXCEPT
     return store_.point.negative_search_count();
 }
 
+TEMPLATE
+void CLASS::get_address_screening(size_t& rejects, size_t& probes,
+    size_t samples) const NOEXCEPT
+{
+    store_.address.sample_filter(rejects, probes, samples);
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -0,0 +1,261 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_QUERY_SPENT_IPP
+#define LIBBITCOIN_DATABASE_QUERY_SPENT_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// Confirmed-spent bitmap.
+// ----------------------------------------------------------------------------
+// One bit per outs record (dense output ordinal), set by push_confirmed for
+// each prevout of the block and cleared by pop_confirmed. Bits beyond the
+// bitmap body are implicitly unspent. The bitmap is not maintained for blocks
+// confirmed before it was introduced, so rebuild_spent() populates it and
+// marks it complete. Until then is_confirmed_spent() resolves spenders.
+
+TEMPLATE
+outs_link CLASS::to_outs(const output_link& link) const NOEXCEPT
+{
+    using namespace system;
+    table::transaction::get_output first{ {}, 0 };
+    if (!store_.tx.get(to_output_tx(link), first) || is_zero(first.number))
+        return {};
+
+    // Output fks of a tx ascend (see outs::put_ref), so the ordinal is found
+    // by bisection of the tx's outs records, not by a scan of its outputs.
+    auto low = first.outs_fk;
+    auto high = low + first.number;
+    while (low < high)
+    {
+        const auto middle = low + (high - low) / two;
+        table::outs::get_output out{};
+        if (!store_.outs.get(middle, out))
+            return {};
+
+        if (out.out_fk == link.value)
+            return middle;
+
+        if (out.out_fk < link.value)
+            low = add1(middle);
+        else
+            high = middle;
+    }
+
+    return {};
+}
+
+TEMPLATE
+outs_link CLASS::to_outs(const tx_link& link, uint32_t index) const NOEXCEPT
+{
+    // The ordinal of a known output index is the tx's first outs record plus
+    // the index (terminal if index is out of range).
+    table::transaction::get_output out{ {}, index };
+    if (!store_.tx.get(link, out))
+        return {};
+
+    return out.outs_fk;
+}
+
+TEMPLATE
+bool CLASS::is_spent_bit(const outs_link& link) const NOEXCEPT
+{
+    if (link.is_terminal())
+        return false;
+
+    // Unpopulated tail of bitmap is unspent (get fails beyond count).
+    table::spent::record spent{};
+    return store_.spent.get(table::spent::to_byte(link), spent) &&
+        spent.is_spent(link);
+}
+
+TEMPLATE
+code CLASS::rebuild_spent(const stopper& cancel) NOEXCEPT
+{
+    using namespace system;
+    using bits = std::atomic<uint8_t>;
+    constexpr auto parallel = poolstl::execution::par;
+    const auto records = possible_narrow_cast<outs_link::integer>(outs_records());
+    const auto blocks = store_.confirmed.count().value;
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Reset bitmap to zeroed (incomplete) cover of all outs records.
+    if (!store_.spent.set_complete(false) ||
+        !store_.spent.truncate(spent_link::integer{}) ||
+        !expand_spent(ceilinged_divide(records, byte_bits)))
+        return error::integrity;
+
+    const auto ptr = store_.spent.get_memory();
+    if (!ptr)
+        return error::integrity;
+
+    stopper fail{};
+    std::vector<size_t> offsets(blocks);
+    std::iota(offsets.begin(), offsets.end(), zero);
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    // Bitmap does not remap, so one memory pointer serves all threads. Blocks
+    // may share bitmap bytes, so bits are set atomically.
+    std::for_each(parallel, offsets.cbegin(), offsets.cend(),
+        [&](const size_t& height) NOEXCEPT
+        {
+            if (cancel.load(relaxed) || fail.load(relaxed))
+                return;
+
+            // Sequential within block (to_block_spent_outs is parallel).
+            const auto txs = to_transactions(to_confirmed(height));
+            for (const auto& point: to_points(txs))
+            {
+                const auto out = to_prevout_outs(point);
+                if (out.is_terminal())
+                    continue;
+
+                const auto raw = ptr->offset(table::spent::to_byte(out));
+                if (is_null(raw))
+                {
+                    fail.store(true, relaxed);
+                    return;
+                }
+
+                // xcode clang++16 does not support C++20 std::atomic_ref.
+                auto& byte = *pointer_cast<bits>(raw);
+                byte.fetch_or(table::spent::to_mask(out), relaxed);
+            }
+        });
+
+    if (fail.load(relaxed)) return error::integrity;
+    if (cancel.load(relaxed)) return error::canceled;
+    return store_.spent.set_complete(true) ? error::success : error::integrity;
+    // ========================================================================
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+outs_link CLASS::to_prevout_outs(const point_link& link) const NOEXCEPT
+{
+    table::point::record point{};
+    if (!store_.point.get(link, point) || point.is_null())
+        return {};
+
+    return to_outs(to_tx(point.hash), point.index);
+}
+
+TEMPLATE
+outs_links CLASS::to_block_spent_outs(const header_link& link) const NOEXCEPT
+{
+    // Coinbase point is null, so all txs are included (no position test).
+    const auto ins = to_points(to_transactions(link));
+    outs_links outs(ins.size());
+    constexpr auto parallel = poolstl::execution::par;
+
+    std::transform(parallel, ins.cbegin(), ins.cend(), outs.begin(),
+        [&](const auto& spend) NOEXCEPT
+        {
+            return to_prevout_outs(spend);
+        });
+
+    return outs;
+}
+
+TEMPLATE
+bool CLASS::expand_spent(size_t bytes) NOEXCEPT
+{
+    using namespace system;
+    const auto count = store_.spent.count().value;
+    if (bytes <= count)
+        return true;
+
+    // Expansion exposes prior content after a truncation, so zeroize it.
+    if (!store_.spent.expand(possible_narrow_cast<spent_link::integer>(bytes)))
+        return false;
+
+    const auto ptr = store_.spent.get_memory();
+    const auto raw = ptr ? ptr->offset(count) : nullptr;
+    if (is_null(raw))
+        return false;
+
+    std::fill_n(raw, bytes - count, uint8_t{});
+    return true;
+}
+
+TEMPLATE
+bool CLASS::set_spent(const outs_links& outs, bool spent) NOEXCEPT
+{
+    using namespace system;
+    using bits = std::atomic<uint8_t>;
+    auto any = false;
+    outs_link::integer top{};
+    for (const auto& out: outs)
+    {
+        if (out != outs_link::terminal)
+        {
+            top = std::max(top, out);
+            any = true;
+        }
+    }
+
+    // No resolved prevouts (e.g. coinbase only).
+    if (!any)
+        return true;
+
+    // Clearing bits beyond the bitmap body is a no-op, so only set expands.
+    if (spent && !expand_spent(add1(table::spent::to_byte(top))))
+        return false;
+
+    const auto ptr = store_.spent.get_memory();
+    if (!ptr)
+        return false;
+
+    for (const auto& out: outs)
+    {
+        if (out == outs_link::terminal)
+            continue;
+
+        const auto raw = ptr->offset(table::spent::to_byte(out));
+        if (is_null(raw))
+        {
+            if (spent) return false;
+            continue;
+        }
+
+        // xcode clang++16 does not support C++20 std::atomic_ref.
+        const auto mask = table::spent::to_mask(out);
+        auto& byte = *pointer_cast<bits>(raw);
+        if (spent)
+            byte.fetch_or(mask, std::memory_order_relaxed);
+        else
+            byte.fetch_and(bit_not(mask), std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
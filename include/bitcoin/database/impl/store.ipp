@@ -19,8 +19,10 @@
 #ifndef LIBBITCOIN_DATABASE_STORE_IPP
 #define LIBBITCOIN_DATABASE_STORE_IPP
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <numeric>
 #include <unordered_map>
 #include <bitcoin/database/define.hpp>
 
@@ -47,7 +49,13 @@ const std::unordered_map<event_t, std::string> CLASS::events
     { event_t::close_file, "close_file" },
     { event_t::create_table, "create_table" },
     { event_t::verify_table, "verify_table" },
+    { event_t::migrate_table, "migrate_table" },
+    { event_t::rebuild_table, "rebuild_table" },
     { event_t::close_table, "close_table" },
+    { event_t::load_bloom, "load_bloom" },
+    { event_t::prefault_file, "prefault_file" },
+    { event_t::follow_table, "follow_table" },
+    { event_t::publish_table, "publish_table" },
 
     { event_t::wait_lock, "wait_lock" },
     { event_t::flush_body, "flush_body" },
@@ -101,6 +109,12 @@ const std::unordered_map<table_t, std::string> CLASS::tables
     { table_t::strong_tx_table, "strong_tx_table" },
     { table_t::strong_tx_head, "strong_tx_head" },
     { table_t::strong_tx_body, "strong_tx_body" },
+    { table_t::spent_table, "spent_table" },
+    { table_t::spent_head, "spent_head" },
+    { table_t::spent_body, "spent_body" },
+    { table_t::subroot_table, "subroot_table" },
+    { table_t::subroot_head, "subroot_head" },
+    { table_t::subroot_body, "subroot_body" },
 
     // Caches.
     { table_t::duplicate_table, "duplicate_table" },
@@ -109,12 +123,18 @@ const std::unordered_map<table_t, std::string> CLASS::tables
     { table_t::prevout_table, "prevout_table" },
     { table_t::prevout_head, "prevout_head" },
     { table_t::prevout_body, "prevout_body" },
+    { table_t::prevout1_table, "prevout1_table" },
+    { table_t::prevout1_head, "prevout1_head" },
+    { table_t::prevout1_body, "prevout1_body" },
     { table_t::validated_bk_table, "validated_bk_table" },
     { table_t::validated_bk_head, "validated_bk_head" },
     { table_t::validated_bk_body, "validated_bk_body" },
     { table_t::validated_tx_table, "validated_tx_table" },
     { table_t::validated_tx_head, "validated_tx_head" },
     { table_t::validated_tx_body, "validated_tx_body" },
+    { table_t::validated_tx1_table, "validated_tx1_table" },
+    { table_t::validated_tx1_head, "validated_tx1_head" },
+    { table_t::validated_tx1_body, "validated_tx1_body" },
 
     // Optionals.
     { table_t::address_table, "address_table" },
@@ -125,7 +145,17 @@ const std::unordered_map<table_t, std::string> CLASS::tables
     { table_t::filter_bk_body, "filter_bk_body" },
     { table_t::filter_tx_table, "filter_tx_table" },
     { table_t::filter_tx_head, "filter_tx_head" },
-    { table_t::filter_tx_body, "filter_tx_body" }
+    { table_t::filter_tx_body, "filter_tx_body" },
+    { table_t::fee_bk_table, "fee_bk_table" },
+    { table_t::fee_bk_head, "fee_bk_head" },
+    { table_t::fee_bk_body, "fee_bk_body" },
+
+    { table_t::pool0_table, "pool0_table" },
+    { table_t::pool0_head, "pool0_head" },
+    { table_t::pool0_body, "pool0_body" },
+    { table_t::pool1_table, "pool1_table" },
+    { table_t::pool1_head, "pool1_head" },
+    { table_t::pool1_body, "pool1_body" }
 };
 
 TEMPLATE
@@ -135,87 +165,125 @@ CLASS::store(const settings& config) NOEXCEPT
     // Archive.
     // ------------------------------------------------------------------------
 
-    header_head_(head(config.path / schema::dir::heads, schema::archive::header), 1, 0, random),
-    header_body_(body(config.path, schema::archive::header), config.header_size, config.header_rate, sequential),
+    header_head_(head(config, schema::archive::header), 1, 0, random, config.read_only),
+    header_body_(body(config, schema::archive::header), config.header_size, config.header_rate, sequential, config.read_only),
     header(header_head_, header_body_, config.header_buckets),
 
-    input_head_(head(config.path / schema::dir::heads, schema::archive::input), 1, 0, random),
-    input_body_(body(config.path, schema::archive::input), config.input_size, config.input_rate, sequential),
+    input_head_(head(config, schema::archive::input), 1, 0, random, config.read_only),
+    input_body_(body(config, schema::archive::input), config.input_size, config.input_rate, sequential, config.read_only),
     input(input_head_, input_body_),
 
-    output_head_(head(config.path / schema::dir::heads, schema::archive::output), 1, 0, random),
-    output_body_(body(config.path, schema::archive::output), config.output_size, config.output_rate, sequential),
+    output_head_(head(config, schema::archive::output), 1, 0, random, config.read_only),
+    output_body_(body(config, schema::archive::output), config.output_size, config.output_rate, sequential, config.read_only),
     output(output_head_, output_body_),
 
-    point_head_(head(config.path / schema::dir::heads, schema::archive::point), 1, 0, random),
-    point_body_(body(config.path, schema::archive::point), config.point_size, config.point_rate, sequential),
+    point_head_(head(config, schema::archive::point), 1, 0, random, config.read_only),
+    point_body_(body(config, schema::archive::point), config.point_size, config.point_rate, sequential, config.read_only),
     point(point_head_, point_body_, config.point_buckets),
 
-    ins_head_(head(config.path / schema::dir::heads, schema::archive::ins), 1, 0, random),
-    ins_body_(body(config.path, schema::archive::ins), config.ins_size, config.ins_rate, sequential),
+    ins_head_(head(config, schema::archive::ins), 1, 0, random, config.read_only),
+    ins_body_(body(config, schema::archive::ins), config.ins_size, config.ins_rate, sequential, config.read_only),
     ins(ins_head_, ins_body_),
 
-    outs_head_(head(config.path / schema::dir::heads, schema::archive::outs), 1, 0, random),
-    outs_body_(body(config.path, schema::archive::outs), config.outs_size, config.outs_rate, sequential),
+    outs_head_(head(config, schema::archive::outs), 1, 0, random, config.read_only),
+    outs_body_(body(config, schema::archive::outs), config.outs_size, config.outs_rate, sequential, config.read_only),
     outs(outs_head_, outs_body_),
 
-    tx_head_(head(config.path / schema::dir::heads, schema::archive::tx), 1, 0, random),
-    tx_body_(body(config.path, schema::archive::tx), config.tx_size, config.tx_rate, sequential),
+    tx_head_(head(config, schema::archive::tx), 1, 0, random, config.read_only),
+    tx_body_(body(config, schema::archive::tx), config.tx_size, config.tx_rate, sequential, config.read_only),
     tx(tx_head_, tx_body_, config.tx_buckets),
 
-    txs_head_(head(config.path / schema::dir::heads, schema::archive::txs), 1, 0, random),
-    txs_body_(body(config.path, schema::archive::txs), config.txs_size, config.txs_rate, sequential),
+    txs_head_(head(config, schema::archive::txs), 1, 0, random, config.read_only),
+    txs_body_(body(config, schema::archive::txs), config.txs_size, config.txs_rate, sequential, config.read_only),
     txs(txs_head_, txs_body_, config.txs_buckets),
 
     // Indexes.
     // ------------------------------------------------------------------------
 
-    candidate_head_(head(config.path / schema::dir::heads, schema::indexes::candidate), 1, 0, random),
-    candidate_body_(body(config.path, schema::indexes::candidate), config.candidate_size, config.candidate_rate, sequential),
+    candidate_head_(head(config, schema::indexes::candidate), 1, 0, random, config.read_only),
+    candidate_body_(body(config, schema::indexes::candidate), config.candidate_size, config.candidate_rate, sequential, config.read_only),
     candidate(candidate_head_, candidate_body_),
 
-    confirmed_head_(head(config.path / schema::dir::heads, schema::indexes::confirmed), 1, 0, random),
-    confirmed_body_(body(config.path, schema::indexes::confirmed), config.confirmed_size, config.confirmed_rate, sequential),
+    confirmed_head_(head(config, schema::indexes::confirmed), 1, 0, random, config.read_only),
+    confirmed_body_(body(config, schema::indexes::confirmed), config.confirmed_size, config.confirmed_rate, sequential, config.read_only),
     confirmed(confirmed_head_, confirmed_body_),
 
-    strong_tx_head_(head(config.path / schema::dir::heads, schema::indexes::strong_tx), 1, 0, random),
-    strong_tx_body_(body(config.path, schema::indexes::strong_tx), config.strong_tx_size, config.strong_tx_rate, sequential),
+    strong_tx_head_(head(config, schema::indexes::strong_tx), 1, 0, random, config.read_only),
+    strong_tx_body_(body(config, schema::indexes::strong_tx), config.strong_tx_size, config.strong_tx_rate, sequential, config.read_only),
     strong_tx(strong_tx_head_, strong_tx_body_, config.strong_tx_buckets),
 
+    spent_head_(head(config, schema::indexes::spent), 1, 0, random, config.read_only),
+    spent_body_(body(config, schema::indexes::spent), config.spent_size, config.spent_rate, sequential, config.read_only),
+    spent(spent_head_, spent_body_),
+
+    subroot_head_(head(config, schema::indexes::subroot), 1, 0, random, config.read_only),
+    subroot_body_(body(config, schema::indexes::subroot), config.subroot_size, config.subroot_rate, sequential, config.read_only),
+    subroot(subroot_head_, subroot_body_),
+
     // Caches.
     // ------------------------------------------------------------------------
 
-    duplicate_head_(head(config.path / schema::dir::heads, schema::caches::duplicate), 1, 0, random),
-    duplicate_body_(body(config.path, schema::caches::duplicate), config.duplicate_size, config.duplicate_rate, sequential),
+    duplicate_head_(head(config, schema::caches::duplicate), 1, 0, random, config.read_only),
+    duplicate_body_(body(config, schema::caches::duplicate), config.duplicate_size, config.duplicate_rate, sequential, config.read_only),
     duplicate(duplicate_head_, duplicate_body_, config.duplicate_buckets),
 
-    prevout_head_(head(config.path / schema::dir::heads, schema::caches::prevout), 1, 0, random),
-    prevout_body_(body(config.path, schema::caches::prevout), config.prevout_size, config.prevout_rate, sequential),
+    prevout_head_(head(config, schema::caches::prevout), 1, 0, random, config.read_only),
+    prevout_body_(body(config, schema::caches::prevout), config.prevout_size, config.prevout_rate, sequential, config.read_only),
     prevout(prevout_head_, prevout_body_, config.prevout_buckets),
 
-    validated_bk_head_(head(config.path / schema::dir::heads, schema::caches::validated_bk), 1, 0, random),
-    validated_bk_body_(body(config.path, schema::caches::validated_bk), config.validated_bk_size, config.validated_bk_rate, sequential),
+    // Second generation of the same configuration (see prune).
+    prevout1_head_(head(config, schema::caches::prevout1), 1, 0, random, config.read_only),
+    prevout1_body_(body(config, schema::caches::prevout1), config.prevout_size, config.prevout_rate, sequential, config.read_only),
+    prevout1(prevout1_head_, prevout1_body_, config.prevout_buckets),
+
+    validated_bk_head_(head(config, schema::caches::validated_bk), 1, 0, random, config.read_only),
+    validated_bk_body_(body(config, schema::caches::validated_bk), config.validated_bk_size, config.validated_bk_rate, sequential, config.read_only),
     validated_bk(validated_bk_head_, validated_bk_body_, config.validated_bk_buckets),
 
-    validated_tx_head_(head(config.path / schema::dir::heads, schema::caches::validated_tx), 1, 0, random),
-    validated_tx_body_(body(config.path, schema::caches::validated_tx), config.validated_tx_size, config.validated_tx_rate, sequential),
+    validated_tx_head_(head(config, schema::caches::validated_tx), 1, 0, random, config.read_only),
+    validated_tx_body_(body(config, schema::caches::validated_tx), config.validated_tx_size, config.validated_tx_rate, sequential, config.read_only),
     validated_tx(validated_tx_head_, validated_tx_body_, config.validated_tx_buckets),
 
+    // Second generation of the same configuration (see validated_tx_window).
+    validated_tx1_head_(head(config, schema::caches::validated_tx1), 1, 0, random, config.read_only),
+    validated_tx1_body_(body(config, schema::caches::validated_tx1), config.validated_tx_size, config.validated_tx_rate, sequential, config.read_only),
+    validated_tx1(validated_tx1_head_, validated_tx1_body_, config.validated_tx_buckets),
+
     // Optionals.
     // ------------------------------------------------------------------------
 
-    address_head_(head(config.path / schema::dir::heads, schema::optionals::address), 1, 0, random),
-    address_body_(body(config.path, schema::optionals::address), config.address_size, config.address_rate, sequential),
+    address_head_(head(config, schema::optionals::address), 1, 0, random, config.read_only),
+    address_body_(body(config, schema::optionals::address), config.address_size, config.address_rate, sequential, config.read_only),
     address(address_head_, address_body_, config.address_buckets),
 
-    filter_bk_head_(head(config.path / schema::dir::heads, schema::optionals::filter_bk), 1, 0, random),
-    filter_bk_body_(body(config.path, schema::optionals::filter_bk), config.filter_bk_size, config.filter_bk_rate, sequential),
+    filter_bk_head_(head(config, schema::optionals::filter_bk), 1, 0, random, config.read_only),
+    filter_bk_body_(body(config, schema::optionals::filter_bk), config.filter_bk_size, config.filter_bk_rate, sequential, config.read_only),
     filter_bk(filter_bk_head_, filter_bk_body_, config.filter_bk_buckets),
 
-    filter_tx_head_(head(config.path / schema::dir::heads, schema::optionals::filter_tx), 1, 0, random),
-    filter_tx_body_(body(config.path, schema::optionals::filter_tx), config.filter_tx_size, config.filter_tx_rate, sequential),
+    filter_tx_head_(head(config, schema::optionals::filter_tx), 1, 0, random, config.read_only),
+    filter_tx_body_(body(config, schema::optionals::filter_tx), config.filter_tx_size, config.filter_tx_rate, sequential, config.read_only),
     filter_tx(filter_tx_head_, filter_tx_body_, config.filter_tx_buckets),
 
+    fee_bk_head_(head(config, schema::optionals::fee_bk), 1, 0, random, config.read_only),
+    fee_bk_body_(body(config, schema::optionals::fee_bk), config.fee_bk_size, config.fee_bk_rate, sequential, config.read_only),
+    fee_bk(fee_bk_head_, fee_bk_body_, config.fee_bk_buckets),
+
+    // Pool (two generations of the same configuration).
+    // ------------------------------------------------------------------------
+
+    pool0_head_(head(config, schema::optionals::pool0), 1, 0, random, config.read_only),
+    pool0_body_(body(config, schema::optionals::pool0), config.pool_size, config.pool_rate, sequential, config.read_only),
+    pool0(pool0_head_, pool0_body_, config.pool_buckets),
+
+    pool1_head_(head(config, schema::optionals::pool1), 1, 0, random, config.read_only),
+    pool1_body_(body(config, schema::optionals::pool1), config.pool_size, config.pool_rate, sequential, config.read_only),
+    pool1(pool1_head_, pool1_body_, config.pool_buckets),
+
+    // Memory.
+    // ------------------------------------------------------------------------
+
+    tx_bloom(system::limit<size_t>(config.tx_bloom_limit)),
+
     // Locks.
     // ------------------------------------------------------------------------
 
@@ -238,9 +306,42 @@ uint8_t CLASS::interval_depth() const NOEXCEPT
     return system::limit<uint8_t>(configuration_.interval_depth);
 }
 
+TEMPLATE
+size_t CLASS::wire_cache_limit() const NOEXCEPT
+{
+    return system::limit<size_t>(configuration_.wire_cache_limit);
+}
+
+TEMPLATE
+size_t CLASS::merkle_cache_limit() const NOEXCEPT
+{
+    return system::limit<size_t>(configuration_.merkle_cache_limit);
+}
+
+TEMPLATE
+size_t CLASS::short_id_limit() const NOEXCEPT
+{
+    return system::limit<size_t>(configuration_.short_id_limit);
+}
+
+TEMPLATE
+size_t CLASS::pool_limit() const NOEXCEPT
+{
+    return system::limit<size_t>(configuration_.pool_limit);
+}
+
+TEMPLATE
+size_t CLASS::validated_tx_window() const NOEXCEPT
+{
+    return configuration_.validated_tx_window;
+}
+
 TEMPLATE
 code CLASS::create(const event_handler& handler) NOEXCEPT
 {
+    if (configuration_.read_only)
+        return error::read_only_store;
+
     if (!transactor_mutex_.try_lock())
         return error::transactor_lock;
 
@@ -270,6 +371,11 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     static const auto heads = configuration_.path / schema::dir::heads;
     auto ec = file::clear_directory_ex(heads);
 
+    // Ensure directories of overridden table files exist.
+    for (const auto& entry: configuration_.paths)
+        if (!ec && !file::is_directory(entry.second))
+            ec = file::create_directory_ex(entry.second);
+
     create(ec, header_head_, table_t::header_head);
     create(ec, header_body_, table_t::header_body);
     create(ec, input_head_, table_t::input_head);
@@ -293,15 +399,23 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     create(ec, confirmed_body_, table_t::confirmed_body);
     create(ec, strong_tx_head_, table_t::strong_tx_head);
     create(ec, strong_tx_body_, table_t::strong_tx_body);
+    create(ec, spent_head_, table_t::spent_head);
+    create(ec, spent_body_, table_t::spent_body);
+    create(ec, subroot_head_, table_t::subroot_head);
+    create(ec, subroot_body_, table_t::subroot_body);
 
     create(ec, duplicate_head_, table_t::duplicate_head);
     create(ec, duplicate_body_, table_t::duplicate_body);
     create(ec, prevout_head_, table_t::prevout_head);
     create(ec, prevout_body_, table_t::prevout_body);
+    create(ec, prevout1_head_, table_t::prevout1_head);
+    create(ec, prevout1_body_, table_t::prevout1_body);
     create(ec, validated_bk_head_, table_t::validated_bk_head);
     create(ec, validated_bk_body_, table_t::validated_bk_body);
     create(ec, validated_tx_head_, table_t::validated_tx_head);
     create(ec, validated_tx_body_, table_t::validated_tx_body);
+    create(ec, validated_tx1_head_, table_t::validated_tx1_head);
+    create(ec, validated_tx1_body_, table_t::validated_tx1_body);
 
     create(ec, address_head_, table_t::address_head);
     create(ec, address_body_, table_t::address_body);
@@ -309,6 +423,12 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     create(ec, filter_bk_body_, table_t::filter_bk_body);
     create(ec, filter_tx_head_, table_t::filter_tx_head);
     create(ec, filter_tx_body_, table_t::filter_tx_body);
+    create(ec, fee_bk_head_, table_t::fee_bk_head);
+    create(ec, fee_bk_body_, table_t::fee_bk_body);
+    create(ec, pool0_head_, table_t::pool0_head);
+    create(ec, pool0_body_, table_t::pool0_body);
+    create(ec, pool1_head_, table_t::pool1_head);
+    create(ec, pool1_body_, table_t::pool1_body);
 
     const auto populate = [&handler](code& ec, auto& storage,
         table_t table) NOEXCEPT
@@ -336,15 +456,29 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     populate(ec, candidate, table_t::candidate_table);
     populate(ec, confirmed, table_t::confirmed_table);
     populate(ec, strong_tx, table_t::strong_tx_table);
+    populate(ec, spent, table_t::spent_table);
+    populate(ec, subroot, table_t::subroot_table);
 
     populate(ec, duplicate, table_t::duplicate_table);
     populate(ec, prevout, table_t::prevout_table);
+    populate(ec, prevout1, table_t::prevout1_table);
     populate(ec, validated_bk, table_t::validated_bk_table);
     populate(ec, validated_tx, table_t::validated_tx_table);
+    populate(ec, validated_tx1, table_t::validated_tx1_table);
 
     populate(ec, address, table_t::address_table);
     populate(ec, filter_bk, table_t::filter_bk_table);
     populate(ec, filter_tx, table_t::filter_tx_table);
+    populate(ec, fee_bk, table_t::fee_bk_table);
+    populate(ec, pool0, table_t::pool0_table);
+    populate(ec, pool1, table_t::pool1_table);
+
+    // An empty bitmap covers all (no) confirmed blocks.
+    if (!ec && !spent.set_complete(true))
+        ec = error::create_table;
+
+    if (!ec)
+        load_bloom(handler);
 
     if (ec)
     {
@@ -371,6 +505,18 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
     if (!transactor_mutex_.try_lock())
         return error::transactor_lock;
 
+    // The process and flush locks are held by the writer process. Tables are
+    // neither migrated nor verified, and the tx bloom filter remains unloaded
+    // (reports all keys as possibly stored).
+    if (configuration_.read_only)
+    {
+        auto ec = open_load(handler);
+        if (!ec) ec = follow(handler);
+        if (ec) /* code */ unload_close(handler);
+        transactor_mutex_.unlock();
+        return ec;
+    }
+
     if (!process_lock_.try_lock())
     {
         transactor_mutex_.unlock();
@@ -395,7 +541,11 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
         }
     };
 
-    auto ec = open_load(handler);
+    auto ec = add_files(handler);
+    if (!ec) ec = open_load(handler);
+
+    add_tables(ec, handler);
+    migrate(ec, handler);
 
     verify(ec, header, table_t::header_table);
     verify(ec, input, table_t::input_table);
@@ -409,15 +559,25 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
     verify(ec, candidate, table_t::candidate_table);
     verify(ec, confirmed, table_t::confirmed_table);
     verify(ec, strong_tx, table_t::strong_tx_table);
+    verify(ec, spent, table_t::spent_table);
+    verify(ec, subroot, table_t::subroot_table);
 
     verify(ec, duplicate, table_t::duplicate_table);
     verify(ec, prevout, table_t::prevout_table);
+    verify(ec, prevout1, table_t::prevout1_table);
     verify(ec, validated_bk, table_t::validated_bk_table);
     verify(ec, validated_tx, table_t::validated_tx_table);
+    verify(ec, validated_tx1, table_t::validated_tx1_table);
 
     verify(ec, address, table_t::address_table);
     verify(ec, filter_bk, table_t::filter_bk_table);
     verify(ec, filter_tx, table_t::filter_tx_table);
+    verify(ec, fee_bk, table_t::fee_bk_table);
+    verify(ec, pool0, table_t::pool0_table);
+    verify(ec, pool1, table_t::pool1_table);
+
+    if (!ec)
+        load_bloom(handler);
 
     if (ec)
     {
@@ -430,14 +590,22 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
 
     // process and flush locks remain open until close().
     transactor_mutex_.unlock();
+
+    // Rebuilds take the transactor, store is closed upon failure.
+    if (!ec && (ec = rebuild(handler)))
+        /* code */ close(handler);
+
     return ec;
 }
 
 TEMPLATE
 code CLASS::prune(const event_handler& handler) NOEXCEPT
 {
+    if (configuration_.read_only)
+        return error::read_only_store;
+
     // Transactor lock generally only covers writes, but in this case prevout
-    // reads must also be guarded since the body shrinks and head is cleared.
+    // reads must also be guarded since the current prevout table is swapped.
     while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
     {
         handler(event_t::wait_lock, table_t::store);
@@ -445,49 +613,27 @@ code CLASS::prune(const event_handler& handler) NOEXCEPT
 
     code ec{ error::success };
 
+    // The retired generation is current again after another swap, so it must
+    // first be emptied by snapshot.
+    if (prevout_retired_)
+    {
+        ec = error::pending_prune;
+    }
+
     // Prevouts resettable if all candidates confirmed (fork is candidate top).
-    if (!query<CLASS>{ *this }.is_coalesced())
+    else if (!query<CLASS>{ *this }.is_coalesced())
     {
         ec = error::not_coalesced;
     }
     else
     {
-        // nullify table head, set reference body count to zero.
-        handler(event_t::prune_table, table_t::prevout_head);
-        if (!prevout.clear())
-        {
-            ec = error::prune_table;
-        }
-        else
-        {
-            // Snapshot with nullified head and zero body count.
-            // The 'prune' parameter signals to not reset body count.
-            ec = snapshot(handler, true);
-
-            // If the pruning fails here the snapshot remains valid.
-            if (!ec)
-            {
-                // zeroize table body, set logical body count to zero.
-                handler(event_t::prune_table, table_t::prevout_body);
-                if (!prevout_body_.truncate(zero))
-                {
-                    ec = error::prune_table;
-                }
-                else
-                {
-                    // unmap body, setting mapped size to logical size (zero).
-                    handler(event_t::unload_file, table_t::prevout_body);
-                    ec = prevout_body_.unload();
-
-                    if (!ec)
-                    {
-                        // map body, making table usable again.
-                        handler(event_t::load_file, table_t::prevout_body);
-                        ec = prevout_body_.load();
-                    }
-                }
-            }
-        }
+        // Swap generations, the retired one is emptied by the next snapshot.
+        // Its truncation must follow a snapshot in any case, as all existing
+        // snapshots are otherwise invalidated, so there is no other pause.
+        prevout_generation_ = add1(prevout_generation_);
+        prevout_retired_ = true;
+        handler(event_t::prune_table, system::is_odd(prevout_generation_) ?
+            table_t::prevout_table : table_t::prevout1_table);
     }
 
     transactor_mutex_.unlock();
@@ -495,14 +641,41 @@ code CLASS::prune(const event_handler& handler) NOEXCEPT
 }
 
 TEMPLATE
-code CLASS::snapshot(const event_handler& handler, bool prune) NOEXCEPT
+table::prevout& CLASS::current_prevout() NOEXCEPT
+{
+    return system::is_odd(prevout_generation_) ? prevout1 : prevout;
+}
+
+TEMPLATE
+table::prevout& CLASS::prior_prevout() NOEXCEPT
+{
+    return system::is_odd(prevout_generation_) ? prevout : prevout1;
+}
+
+TEMPLATE
+code CLASS::snapshot(const event_handler& handler) NOEXCEPT
 {
-    while (!prune && !transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
+    if (configuration_.read_only)
+        return error::read_only_store;
+
+    while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
     {
         handler(event_t::wait_lock, table_t::store);
     }
 
     code ec{ error::success };
+
+    // A retired prevout generation is nullified before backup, which then
+    // captures its null head links and zero body count (see prune).
+    const auto prune = prevout_retired_;
+    const auto odd = system::is_odd(prevout_generation_);
+    if (prune)
+    {
+        handler(event_t::prune_table, odd ? table_t::prevout_head :
+            table_t::prevout1_head);
+        if (!prior_prevout().clear())
+            ec = error::prune_table;
+    }
     const auto flush = [&handler](code& ec, auto& storage, table_t table) NOEXCEPT
     {
         if (!ec)
@@ -525,24 +698,64 @@ code CLASS::snapshot(const event_handler& handler, bool prune) NOEXCEPT
     flush(ec, candidate_body_, table_t::candidate_body);
     flush(ec, confirmed_body_, table_t::confirmed_body);
     flush(ec, strong_tx_body_, table_t::strong_tx_body);
+    flush(ec, spent_body_, table_t::spent_body);
+    flush(ec, subroot_body_, table_t::subroot_body);
 
     flush(ec, duplicate_body_, table_t::duplicate_body);
-    if (!prune) flush(ec, prevout_body_, table_t::prevout_body);
+    if (!prune || !odd) flush(ec, prevout_body_, table_t::prevout_body);
+    if (!prune || odd) flush(ec, prevout1_body_, table_t::prevout1_body);
     flush(ec, validated_bk_body_, table_t::validated_bk_body);
     flush(ec, validated_tx_body_, table_t::validated_tx_body);
+    flush(ec, validated_tx1_body_, table_t::validated_tx1_body);
 
     flush(ec, address_body_, table_t::address_body);
     flush(ec, filter_bk_body_, table_t::filter_bk_body);
     flush(ec, filter_tx_body_, table_t::filter_tx_body);
+    flush(ec, fee_bk_body_, table_t::fee_bk_body);
+    flush(ec, pool0_body_, table_t::pool0_body);
+    flush(ec, pool1_body_, table_t::pool1_body);
 
     if (!ec) ec = backup(handler, prune);
-    if (!prune) transactor_mutex_.unlock();
+
+    // If the pruning fails here the snapshot remains valid.
+    if (!ec && prune) ec = prune_prevout(handler);
+    transactor_mutex_.unlock();
     return ec;
 }
 
+// protected
+TEMPLATE
+code CLASS::prune_prevout(const event_handler& handler) NOEXCEPT
+{
+    const auto odd = system::is_odd(prevout_generation_);
+    auto& body = odd ? prevout_body_ : prevout1_body_;
+    const auto table = odd ? table_t::prevout_body : table_t::prevout1_body;
+
+    // zeroize table body, set logical body count to zero.
+    handler(event_t::prune_table, table);
+    if (!body.truncate(zero))
+        return error::prune_table;
+
+    // unmap body, setting mapped size to logical size (zero).
+    handler(event_t::unload_file, table);
+    if (const auto ec = body.unload())
+        return ec;
+
+    // map body, making table usable again.
+    handler(event_t::load_file, table);
+    if (const auto ec = body.load())
+        return ec;
+
+    prevout_retired_ = false;
+    return error::success;
+}
+
 TEMPLATE
 code CLASS::reload(const event_handler& handler) NOEXCEPT
 {
+    if (configuration_.read_only)
+        return error::read_only_store;
+
     while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
     {
         handler(event_t::wait_lock, table_t::store);
@@ -587,15 +800,23 @@ code CLASS::reload(const event_handler& handler) NOEXCEPT
     reload(ec, confirmed_body_, table_t::confirmed_body);
     reload(ec, strong_tx_head_, table_t::strong_tx_head);
     reload(ec, strong_tx_body_, table_t::strong_tx_body);
+    reload(ec, spent_head_, table_t::spent_head);
+    reload(ec, spent_body_, table_t::spent_body);
+    reload(ec, subroot_head_, table_t::subroot_head);
+    reload(ec, subroot_body_, table_t::subroot_body);
 
     reload(ec, duplicate_head_, table_t::duplicate_head);
     reload(ec, duplicate_body_, table_t::duplicate_body);
     reload(ec, prevout_head_, table_t::prevout_head);
     reload(ec, prevout_body_, table_t::prevout_body);
+    reload(ec, prevout1_head_, table_t::prevout1_head);
+    reload(ec, prevout1_body_, table_t::prevout1_body);
     reload(ec, validated_bk_head_, table_t::validated_bk_head);
     reload(ec, validated_bk_body_, table_t::validated_bk_body);
     reload(ec, validated_tx_head_, table_t::validated_tx_head);
     reload(ec, validated_tx_body_, table_t::validated_tx_body);
+    reload(ec, validated_tx1_head_, table_t::validated_tx1_head);
+    reload(ec, validated_tx1_body_, table_t::validated_tx1_body);
 
     reload(ec, address_head_, table_t::address_head);
     reload(ec, address_body_, table_t::address_body);
@@ -603,6 +824,12 @@ code CLASS::reload(const event_handler& handler) NOEXCEPT
     reload(ec, filter_bk_body_, table_t::filter_bk_body);
     reload(ec, filter_tx_head_, table_t::filter_tx_head);
     reload(ec, filter_tx_body_, table_t::filter_tx_body);
+    reload(ec, fee_bk_head_, table_t::fee_bk_head);
+    reload(ec, fee_bk_body_, table_t::fee_bk_body);
+    reload(ec, pool0_head_, table_t::pool0_head);
+    reload(ec, pool0_body_, table_t::pool0_body);
+    reload(ec, pool1_head_, table_t::pool1_head);
+    reload(ec, pool1_body_, table_t::pool1_body);
 
     transactor_mutex_.unlock();
     return ec;
@@ -617,6 +844,14 @@ code CLASS::close(const event_handler& handler) NOEXCEPT
         handler(event_t::wait_lock, table_t::store);
     }
 
+    // Table close writes heads, and the writer holds the locks.
+    if (configuration_.read_only)
+    {
+        const auto ec = unload_close(handler);
+        transactor_mutex_.unlock();
+        return ec;
+    }
+
     code ec{ error::success };
     const auto close = [&handler](code& ec, auto& storage, table_t table) NOEXCEPT
     {
@@ -640,18 +875,28 @@ code CLASS::close(const event_handler& handler) NOEXCEPT
     close(ec, candidate, table_t::candidate_table);
     close(ec, confirmed, table_t::confirmed_table);
     close(ec, strong_tx, table_t::strong_tx_table);
+    close(ec, spent, table_t::spent_table);
+    close(ec, subroot, table_t::subroot_table);
 
     close(ec, duplicate, table_t::duplicate_table);
     close(ec, prevout, table_t::prevout_table);
+    close(ec, prevout1, table_t::prevout1_table);
     close(ec, validated_bk, table_t::validated_bk_table);
     close(ec, validated_tx, table_t::validated_tx_table);
+    close(ec, validated_tx1, table_t::validated_tx1_table);
 
     close(ec, address, table_t::address_table);
     close(ec, filter_bk, table_t::filter_bk_table);
     close(ec, filter_tx, table_t::filter_tx_table);
+    close(ec, fee_bk, table_t::fee_bk_table);
+    close(ec, pool0, table_t::pool0_table);
+    close(ec, pool1, table_t::pool1_table);
 
+    if (!ec) ec = save_generations(configuration_.path / schema::dir::heads);
     if (!ec) ec = unload_close(handler);
 
+    tx_bloom.unload();
+
     // unlock errors override ec.
     if (!process_lock_.try_unlock())
         ec = error::process_unlock;
@@ -666,6 +911,81 @@ code CLASS::close(const event_handler& handler) NOEXCEPT
     return ec;
 }
 
+TEMPLATE
+code CLASS::refresh(const event_handler& handler) NOEXCEPT
+{
+    // A writer is always current.
+    if (!configuration_.read_only)
+        return error::success;
+
+    while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
+    {
+        handler(event_t::wait_lock, table_t::store);
+    }
+
+    const auto ec = follow(handler);
+    transactor_mutex_.unlock();
+    return ec;
+}
+
+TEMPLATE
+code CLASS::publish(const event_handler& handler) NOEXCEPT
+{
+    if (configuration_.read_only)
+        return error::read_only_store;
+
+    while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
+    {
+        handler(event_t::wait_lock, table_t::store);
+    }
+
+    code ec{ error::success };
+    const auto publish = [&handler](code& ec, auto& storage,
+        table_t table) NOEXCEPT
+    {
+        if (!ec)
+        {
+            handler(event_t::publish_table, table);
+            if (!storage.backup())
+                ec = error::publish_table;
+        }
+    };
+
+    publish(ec, header, table_t::header_table);
+    publish(ec, input, table_t::input_table);
+    publish(ec, output, table_t::output_table);
+    publish(ec, point, table_t::point_table);
+    publish(ec, ins, table_t::ins_table);
+    publish(ec, outs, table_t::outs_table);
+    publish(ec, tx, table_t::tx_table);
+    publish(ec, txs, table_t::txs_table);
+
+    publish(ec, candidate, table_t::candidate_table);
+    publish(ec, confirmed, table_t::confirmed_table);
+    publish(ec, strong_tx, table_t::strong_tx_table);
+    publish(ec, spent, table_t::spent_table);
+    publish(ec, subroot, table_t::subroot_table);
+
+    publish(ec, duplicate, table_t::duplicate_table);
+    publish(ec, prevout, table_t::prevout_table);
+    publish(ec, prevout1, table_t::prevout1_table);
+    publish(ec, validated_bk, table_t::validated_bk_table);
+    publish(ec, validated_tx, table_t::validated_tx_table);
+    publish(ec, validated_tx1, table_t::validated_tx1_table);
+
+    publish(ec, address, table_t::address_table);
+    publish(ec, filter_bk, table_t::filter_bk_table);
+    publish(ec, filter_tx, table_t::filter_tx_table);
+    publish(ec, fee_bk, table_t::fee_bk_table);
+    publish(ec, pool0, table_t::pool0_table);
+    publish(ec, pool1, table_t::pool1_table);
+
+    // Generations are published with the heads they correspond to.
+    if (!ec) ec = save_generations(configuration_.path / schema::dir::heads);
+    transactor_mutex_.unlock();
+    return ec;
+}
+
 // protected
 // ----------------------------------------------------------------------------
 
@@ -705,15 +1025,23 @@ code CLASS::open_load(const event_handler& handler) NOEXCEPT
     open(ec, confirmed_body_, table_t::confirmed_body);
     open(ec, strong_tx_head_, table_t::strong_tx_head);
     open(ec, strong_tx_body_, table_t::strong_tx_body);
+    open(ec, spent_head_, table_t::spent_head);
+    open(ec, spent_body_, table_t::spent_body);
+    open(ec, subroot_head_, table_t::subroot_head);
+    open(ec, subroot_body_, table_t::subroot_body);
 
     open(ec, duplicate_head_, table_t::duplicate_head);
     open(ec, duplicate_body_, table_t::duplicate_body);
     open(ec, prevout_head_, table_t::prevout_head);
     open(ec, prevout_body_, table_t::prevout_body);
+    open(ec, prevout1_head_, table_t::prevout1_head);
+    open(ec, prevout1_body_, table_t::prevout1_body);
     open(ec, validated_bk_head_, table_t::validated_bk_head);
     open(ec, validated_bk_body_, table_t::validated_bk_body);
     open(ec, validated_tx_head_, table_t::validated_tx_head);
     open(ec, validated_tx_body_, table_t::validated_tx_body);
+    open(ec, validated_tx1_head_, table_t::validated_tx1_head);
+    open(ec, validated_tx1_body_, table_t::validated_tx1_body);
 
     open(ec, address_head_, table_t::address_head);
     open(ec, address_body_, table_t::address_body);
@@ -721,6 +1049,12 @@ code CLASS::open_load(const event_handler& handler) NOEXCEPT
     open(ec, filter_bk_body_, table_t::filter_bk_body);
     open(ec, filter_tx_head_, table_t::filter_tx_head);
     open(ec, filter_tx_body_, table_t::filter_tx_body);
+    open(ec, fee_bk_head_, table_t::fee_bk_head);
+    open(ec, fee_bk_body_, table_t::fee_bk_body);
+    open(ec, pool0_head_, table_t::pool0_head);
+    open(ec, pool0_body_, table_t::pool0_body);
+    open(ec, pool1_head_, table_t::pool1_head);
+    open(ec, pool1_body_, table_t::pool1_body);
 
     const auto load = [&handler](code& ec, auto& storage, table_t table) NOEXCEPT
     {
@@ -754,15 +1088,23 @@ code CLASS::open_load(const event_handler& handler) NOEXCEPT
     load(ec, confirmed_body_, table_t::confirmed_body);
     load(ec, strong_tx_head_, table_t::strong_tx_head);
     load(ec, strong_tx_body_, table_t::strong_tx_body);
+    load(ec, spent_head_, table_t::spent_head);
+    load(ec, spent_body_, table_t::spent_body);
+    load(ec, subroot_head_, table_t::subroot_head);
+    load(ec, subroot_body_, table_t::subroot_body);
 
     load(ec, duplicate_head_, table_t::duplicate_head);
     load(ec, duplicate_body_, table_t::duplicate_body);
     load(ec, prevout_head_, table_t::prevout_head);
     load(ec, prevout_body_, table_t::prevout_body);
+    load(ec, prevout1_head_, table_t::prevout1_head);
+    load(ec, prevout1_body_, table_t::prevout1_body);
     load(ec, validated_bk_head_, table_t::validated_bk_head);
     load(ec, validated_bk_body_, table_t::validated_bk_body);
     load(ec, validated_tx_head_, table_t::validated_tx_head);
     load(ec, validated_tx_body_, table_t::validated_tx_body);
+    load(ec, validated_tx1_head_, table_t::validated_tx1_head);
+    load(ec, validated_tx1_body_, table_t::validated_tx1_body);
 
     load(ec, address_head_, table_t::address_head);
     load(ec, address_body_, table_t::address_body);
@@ -770,10 +1112,20 @@ code CLASS::open_load(const event_handler& handler) NOEXCEPT
     load(ec, filter_bk_body_, table_t::filter_bk_body);
     load(ec, filter_tx_head_, table_t::filter_tx_head);
     load(ec, filter_tx_body_, table_t::filter_tx_body);
+    load(ec, fee_bk_head_, table_t::fee_bk_head);
+    load(ec, fee_bk_body_, table_t::fee_bk_body);
+    load(ec, pool0_head_, table_t::pool0_head);
+    load(ec, pool0_body_, table_t::pool0_body);
+    load(ec, pool1_head_, table_t::pool1_head);
+    load(ec, pool1_body_, table_t::pool1_body);
 
     // create, open, and restore each invoke open_load.
     const auto dirty = header_body_.size() > schema::header::minrow;
     dirty_.store(dirty, std::memory_order_relaxed);
+
+    if (!ec)
+        ec = load_generations(configuration_.path / schema::dir::heads);
+
     return ec;
 }
 
@@ -813,15 +1165,23 @@ code CLASS::unload_close(const event_handler& handler) NOEXCEPT
     unload(ec, confirmed_body_, table_t::confirmed_body);
     unload(ec, strong_tx_head_, table_t::strong_tx_head);
     unload(ec, strong_tx_body_, table_t::strong_tx_body);
+    unload(ec, spent_head_, table_t::spent_head);
+    unload(ec, spent_body_, table_t::spent_body);
+    unload(ec, subroot_head_, table_t::subroot_head);
+    unload(ec, subroot_body_, table_t::subroot_body);
 
     unload(ec, duplicate_head_, table_t::duplicate_head);
     unload(ec, duplicate_body_, table_t::duplicate_body);
     unload(ec, prevout_head_, table_t::prevout_head);
     unload(ec, prevout_body_, table_t::prevout_body);
+    unload(ec, prevout1_head_, table_t::prevout1_head);
+    unload(ec, prevout1_body_, table_t::prevout1_body);
     unload(ec, validated_bk_head_, table_t::validated_bk_head);
     unload(ec, validated_bk_body_, table_t::validated_bk_body);
     unload(ec, validated_tx_head_, table_t::validated_tx_head);
     unload(ec, validated_tx_body_, table_t::validated_tx_body);
+    unload(ec, validated_tx1_head_, table_t::validated_tx1_head);
+    unload(ec, validated_tx1_body_, table_t::validated_tx1_body);
 
     unload(ec, address_head_, table_t::address_head);
     unload(ec, address_body_, table_t::address_body);
@@ -829,6 +1189,12 @@ code CLASS::unload_close(const event_handler& handler) NOEXCEPT
     unload(ec, filter_bk_body_, table_t::filter_bk_body);
     unload(ec, filter_tx_head_, table_t::filter_tx_head);
     unload(ec, filter_tx_body_, table_t::filter_tx_body);
+    unload(ec, fee_bk_head_, table_t::fee_bk_head);
+    unload(ec, fee_bk_body_, table_t::fee_bk_body);
+    unload(ec, pool0_head_, table_t::pool0_head);
+    unload(ec, pool0_body_, table_t::pool0_body);
+    unload(ec, pool1_head_, table_t::pool1_head);
+    unload(ec, pool1_body_, table_t::pool1_body);
 
     const auto close = [&handler](code& ec, auto& storage, table_t table) NOEXCEPT
     {
@@ -862,15 +1228,23 @@ code CLASS::unload_close(const event_handler& handler) NOEXCEPT
     close(ec, confirmed_body_, table_t::confirmed_body);
     close(ec, strong_tx_head_, table_t::strong_tx_head);
     close(ec, strong_tx_body_, table_t::strong_tx_body);
+    close(ec, spent_head_, table_t::spent_head);
+    close(ec, spent_body_, table_t::spent_body);
+    close(ec, subroot_head_, table_t::subroot_head);
+    close(ec, subroot_body_, table_t::subroot_body);
 
     close(ec, duplicate_head_, table_t::duplicate_head);
     close(ec, duplicate_body_, table_t::duplicate_body);
     close(ec, prevout_head_, table_t::prevout_head);
     close(ec, prevout_body_, table_t::prevout_body);
+    close(ec, prevout1_head_, table_t::prevout1_head);
+    close(ec, prevout1_body_, table_t::prevout1_body);
     close(ec, validated_bk_head_, table_t::validated_bk_head);
     close(ec, validated_bk_body_, table_t::validated_bk_body);
     close(ec, validated_tx_head_, table_t::validated_tx_head);
     close(ec, validated_tx_body_, table_t::validated_tx_body);
+    close(ec, validated_tx1_head_, table_t::validated_tx1_head);
+    close(ec, validated_tx1_body_, table_t::validated_tx1_body);
 
     close(ec, address_head_, table_t::address_head);
     close(ec, address_body_, table_t::address_body);
@@ -878,13 +1252,253 @@ code CLASS::unload_close(const event_handler& handler) NOEXCEPT
     close(ec, filter_bk_body_, table_t::filter_bk_body);
     close(ec, filter_tx_head_, table_t::filter_tx_head);
     close(ec, filter_tx_body_, table_t::filter_tx_body);
+    close(ec, fee_bk_head_, table_t::fee_bk_head);
+    close(ec, fee_bk_body_, table_t::fee_bk_body);
+    close(ec, pool0_head_, table_t::pool0_head);
+    close(ec, pool0_body_, table_t::pool0_body);
+    close(ec, pool1_head_, table_t::pool1_head);
+    close(ec, pool1_body_, table_t::pool1_body);
+
+    return ec;
+}
+
+// Create files of tables added since the store was created (from closed).
+// A body without its head is not recoverable, so both are created empty and
+// the head is populated once loaded (see add_tables).
+TEMPLATE
+code CLASS::add_files(const event_handler& handler) NOEXCEPT
+{
+    code ec{ error::success };
+    const auto add = [&handler](code& ec, const auto& head, const auto& body,
+        table_t table) NOEXCEPT
+    {
+        if (!ec && !file::is_file(head.file()))
+        {
+            handler(event_t::create_file, table);
+            ec = file::create_file_ex(head.file());
+            if (!ec) ec = file::create_file_ex(body.file());
+        }
+    };
+
+    // Ensure directories of overridden table files exist.
+    for (const auto& entry: configuration_.paths)
+        if (!ec && !file::is_directory(entry.second))
+            ec = file::create_directory_ex(entry.second);
+
+    add(ec, spent_head_, spent_body_, table_t::spent_table);
+    add(ec, subroot_head_, subroot_body_, table_t::subroot_table);
+    add(ec, prevout1_head_, prevout1_body_, table_t::prevout1_table);
+    add(ec, validated_tx1_head_, validated_tx1_body_, table_t::validated_tx1_table);
+    add(ec, fee_bk_head_, fee_bk_body_, table_t::fee_bk_table);
+    add(ec, pool0_head_, pool0_body_, table_t::pool0_table);
+    add(ec, pool1_head_, pool1_body_, table_t::pool1_table);
+    return ec;
+}
+
+// Populate heads of tables added since the store was created (from loaded).
+// Only an added table has an empty head file. Indexes are rebuilt on open.
+TEMPLATE
+void CLASS::add_tables(code& ec, const event_handler& handler) NOEXCEPT
+{
+    const auto add = [&handler](code& ec, const auto& head, auto& storage,
+        table_t table) NOEXCEPT
+    {
+        if (!ec && is_zero(head.size()))
+        {
+            handler(event_t::create_table, table);
+            if (!storage.create())
+                ec = error::create_table;
+        }
+    };
+
+    add(ec, spent_head_, spent, table_t::spent_table);
+    add(ec, subroot_head_, subroot, table_t::subroot_table);
+    add(ec, prevout1_head_, prevout1, table_t::prevout1_table);
+    add(ec, validated_tx1_head_, validated_tx1, table_t::validated_tx1_table);
+    add(ec, fee_bk_head_, fee_bk, table_t::fee_bk_table);
+    add(ec, pool0_head_, pool0, table_t::pool0_table);
+    add(ec, pool1_head_, pool1, table_t::pool1_table);
+}
+
+// Rebuild heads written in a legacy format (from loaded).
+TEMPLATE
+void CLASS::migrate(code& ec, const event_handler& handler) NOEXCEPT
+{
+    const auto migrate = [&handler](code& ec, auto& storage, size_t cell,
+        table_t table) NOEXCEPT
+    {
+        if (!ec && storage.is_legacy(cell))
+        {
+            handler(event_t::migrate_table, table);
+            if (!storage.migrate(cell))
+                ec = error::migrate_table;
+        }
+    };
+
+    // Address head cells were widened to carry filter bits.
+    migrate(ec, address, schema::address::legacy_cell, table_t::address_table);
+}
+
+// Rebuild indexes that do not cover all confirmed blocks (from loaded).
+// An index added to (or restored in) an existing store is rebuilt once, and
+// queries are correct (if slower) until then. Rebuilds take the transactor.
+TEMPLATE
+code CLASS::rebuild(const event_handler& handler) NOEXCEPT
+{
+    const stopper cancel{};
+    query<CLASS> instance{ *this };
+
+    if (!spent.is_complete())
+    {
+        handler(event_t::rebuild_table, table_t::spent_table);
+        if (const auto ec = instance.rebuild_spent(cancel))
+            return ec;
+    }
+
+    // The subroot cache is rebuilt only if not in sync with confirmed.
+    handler(event_t::rebuild_table, table_t::subroot_table);
+    return instance.rebuild_subroot(cancel);
+}
+
+// Follow the files and published body counts of the writer (read only).
+// Heads are sized to their files, remapping any that have grown, and bodies to
+// the counts last set in their heads (by the writer's close/snapshot/publish).
+// Records written since are reachable by link, but not from head buckets that
+// have advanced since, so lookups may miss until the next refresh. Generations
+// of swapped tables are reloaded, as published with the heads.
+TEMPLATE
+code CLASS::follow(const event_handler& handler) NOEXCEPT
+{
+    auto ec = load_generations(configuration_.path / schema::dir::heads);
+    const auto expand = [](code& ec, auto& storage) NOEXCEPT
+    {
+        if (!ec)
+        {
+            size_t size{};
+            if (!(ec = file::size_ex(size, storage.file())) &&
+                !storage.expand(size))
+                ec = error::follow_table;
+        }
+    };
+
+    expand(ec, header_head_);
+    expand(ec, input_head_);
+    expand(ec, output_head_);
+    expand(ec, point_head_);
+    expand(ec, ins_head_);
+    expand(ec, outs_head_);
+    expand(ec, tx_head_);
+    expand(ec, txs_head_);
+
+    expand(ec, candidate_head_);
+    expand(ec, confirmed_head_);
+    expand(ec, strong_tx_head_);
+    expand(ec, spent_head_);
+    expand(ec, subroot_head_);
+
+    expand(ec, duplicate_head_);
+    expand(ec, prevout_head_);
+    expand(ec, prevout1_head_);
+    expand(ec, validated_bk_head_);
+    expand(ec, validated_tx_head_);
+    expand(ec, validated_tx1_head_);
+
+    expand(ec, address_head_);
+    expand(ec, filter_bk_head_);
+    expand(ec, filter_tx_head_);
+    expand(ec, fee_bk_head_);
+    expand(ec, pool0_head_);
+    expand(ec, pool1_head_);
+
+    const auto follow = [&handler](code& ec, auto& storage,
+        table_t table) NOEXCEPT
+    {
+        if (!ec)
+        {
+            handler(event_t::follow_table, table);
+            if (!storage.follow())
+                ec = error::follow_table;
+        }
+    };
+
+    follow(ec, header, table_t::header_table);
+    follow(ec, input, table_t::input_table);
+    follow(ec, output, table_t::output_table);
+    follow(ec, point, table_t::point_table);
+    follow(ec, ins, table_t::ins_table);
+    follow(ec, outs, table_t::outs_table);
+    follow(ec, tx, table_t::tx_table);
+    follow(ec, txs, table_t::txs_table);
+
+    follow(ec, candidate, table_t::candidate_table);
+    follow(ec, confirmed, table_t::confirmed_table);
+    follow(ec, strong_tx, table_t::strong_tx_table);
+    follow(ec, spent, table_t::spent_table);
+    follow(ec, subroot, table_t::subroot_table);
+
+    follow(ec, duplicate, table_t::duplicate_table);
+    follow(ec, prevout, table_t::prevout_table);
+    follow(ec, prevout1, table_t::prevout1_table);
+    follow(ec, validated_bk, table_t::validated_bk_table);
+    follow(ec, validated_tx, table_t::validated_tx_table);
+    follow(ec, validated_tx1, table_t::validated_tx1_table);
+
+    follow(ec, address, table_t::address_table);
+    follow(ec, filter_bk, table_t::filter_bk_table);
+    follow(ec, filter_tx, table_t::filter_tx_table);
+    follow(ec, fee_bk, table_t::fee_bk_table);
+    follow(ec, pool0, table_t::pool0_table);
+    follow(ec, pool1, table_t::pool1_table);
 
+    const auto dirty = header_body_.size() > schema::header::minrow;
+    dirty_.store(dirty, std::memory_order_relaxed);
     return ec;
 }
 
+// Populate the tx hash filter from the tx table (from loaded).
+// Records are immutable and the store is not yet shared, so keys are read in
+// parallel chunks from a single memory guard. On failure the filter remains
+// unloaded, in which case it reports all keys as possibly stored.
+TEMPLATE
+void CLASS::load_bloom(const event_handler& handler) NOEXCEPT
+{
+    using namespace system;
+    tx_bloom.unload();
+    if (!tx_bloom.enabled())
+        return;
+
+    handler(event_t::load_bloom, table_t::tx_table);
+
+    constexpr size_t chunk = 4096;
+    constexpr auto parallel = poolstl::execution::par;
+    using link = table::transaction::link;
+    const auto count = tx.count().value;
+    std_vector<size_t> chunks(ceilinged_divide(count, chunk));
+    std::iota(chunks.begin(), chunks.end(), zero);
+
+    const auto ptr = tx.get_memory();
+    if (!ptr)
+        return;
+
+    std::for_each(parallel, chunks.begin(), chunks.end(),
+        [&](size_t index) NOEXCEPT
+        {
+            const auto first = index * chunk;
+            const auto last = std::min<size_t>(first + chunk, count);
+            for (auto record = first; record < last; ++record)
+                tx_bloom.insert(table::transaction::get_key(ptr,
+                    possible_narrow_cast<link::integer>(record)));
+        });
+
+    tx_bloom.load();
+}
+
 TEMPLATE
 code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
 {
+    // Only the retired prevout generation is pruned.
+    const auto odd = system::is_odd(prevout_generation_);
+
     code ec{ error::success };
     const auto backup = [&handler](code& ec, auto& storage,
         table_t table, bool prune=false) NOEXCEPT
@@ -909,15 +1523,22 @@ code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
     backup(ec, candidate, table_t::candidate_table);
     backup(ec, confirmed, table_t::confirmed_table);
     backup(ec, strong_tx, table_t::strong_tx_table);
+    backup(ec, spent, table_t::spent_table);
+    backup(ec, subroot, table_t::subroot_table);
 
     backup(ec, duplicate, table_t::duplicate_table);
-    backup(ec, prevout, table_t::prevout_table, prune);
+    backup(ec, prevout, table_t::prevout_table, prune && odd);
+    backup(ec, prevout1, table_t::prevout1_table, prune && !odd);
     backup(ec, validated_bk, table_t::validated_bk_table);
     backup(ec, validated_tx, table_t::validated_tx_table);
+    backup(ec, validated_tx1, table_t::validated_tx1_table);
 
     backup(ec, address, table_t::address_table);
     backup(ec, filter_bk, table_t::filter_bk_table);
     backup(ec, filter_tx, table_t::filter_tx_table);
+    backup(ec, fee_bk, table_t::fee_bk_table);
+    backup(ec, pool0, table_t::pool0_table);
+    backup(ec, pool1, table_t::pool1_table);
 
     if (ec) return ec;
 
@@ -974,15 +1595,22 @@ code CLASS::dump(const path& folder,
     auto candidate_buffer = candidate_head_.get();
     auto confirmed_buffer = confirmed_head_.get();
     auto strong_tx_buffer = strong_tx_head_.get();
+    auto spent_buffer = spent_head_.get();
+    auto subroot_buffer = subroot_head_.get();
 
     auto duplicate_buffer = duplicate_head_.get();
     auto prevout_buffer = prevout_head_.get();
+    auto prevout1_buffer = prevout1_head_.get();
     auto validated_bk_buffer = validated_bk_head_.get();
     auto validated_tx_buffer = validated_tx_head_.get();
+    auto validated_tx1_buffer = validated_tx1_head_.get();
 
     auto address_buffer = address_head_.get();
     auto filter_bk_buffer = filter_bk_head_.get();
     auto filter_tx_buffer = filter_tx_head_.get();
+    auto fee_bk_buffer = fee_bk_head_.get();
+    auto pool0_buffer = pool0_head_.get();
+    auto pool1_buffer = pool1_head_.get();
 
     if (!header_buffer) return error::unloaded_file;
     if (!input_buffer) return error::unloaded_file;
@@ -996,15 +1624,22 @@ code CLASS::dump(const path& folder,
     if (!candidate_buffer) return error::unloaded_file;
     if (!confirmed_buffer) return error::unloaded_file;
     if (!strong_tx_buffer) return error::unloaded_file;
+    if (!spent_buffer) return error::unloaded_file;
+    if (!subroot_buffer) return error::unloaded_file;
 
     if (!duplicate_buffer) return error::unloaded_file;
     if (!prevout_buffer) return error::unloaded_file;
+    if (!prevout1_buffer) return error::unloaded_file;
     if (!validated_bk_buffer) return error::unloaded_file;
     if (!validated_tx_buffer) return error::unloaded_file;
+    if (!validated_tx1_buffer) return error::unloaded_file;
 
     if (!address_buffer) return error::unloaded_file;
     if (!filter_bk_buffer) return error::unloaded_file;
     if (!filter_tx_buffer) return error::unloaded_file;
+    if (!fee_bk_buffer) return error::unloaded_file;
+    if (!pool0_buffer) return error::unloaded_file;
+    if (!pool1_buffer) return error::unloaded_file;
 
     code ec{ error::success };
     const auto dump = [&handler, &folder](code& ec, const auto& storage,
@@ -1030,22 +1665,82 @@ code CLASS::dump(const path& folder,
     dump(ec, candidate_buffer, schema::indexes::candidate, table_t::candidate_head);
     dump(ec, confirmed_buffer, schema::indexes::confirmed, table_t::confirmed_head);
     dump(ec, strong_tx_buffer, schema::indexes::strong_tx, table_t::strong_tx_head);
+    dump(ec, spent_buffer, schema::indexes::spent, table_t::spent_head);
+    dump(ec, subroot_buffer, schema::indexes::subroot, table_t::subroot_head);
 
     dump(ec, duplicate_buffer, schema::caches::duplicate, table_t::duplicate_head);
     dump(ec, prevout_buffer, schema::caches::prevout, table_t::prevout_head);
+    dump(ec, prevout1_buffer, schema::caches::prevout1, table_t::prevout1_head);
     dump(ec, validated_bk_buffer, schema::caches::validated_bk, table_t::validated_bk_head);
     dump(ec, validated_tx_buffer, schema::caches::validated_tx, table_t::validated_tx_head);
+    dump(ec, validated_tx1_buffer, schema::caches::validated_tx1, table_t::validated_tx1_head);
 
     dump(ec, address_buffer, schema::optionals::address, table_t::address_head);
     dump(ec, filter_bk_buffer, schema::optionals::filter_bk, table_t::filter_bk_head);
     dump(ec, filter_tx_buffer, schema::optionals::filter_tx, table_t::filter_tx_head);
+    dump(ec, fee_bk_buffer, schema::optionals::fee_bk, table_t::fee_bk_head);
+    dump(ec, pool0_buffer, schema::optionals::pool0, table_t::pool0_head);
+    dump(ec, pool1_buffer, schema::optionals::pool1, table_t::pool1_head);
 
+    // Generations are captured with the heads they correspond to.
+    if (!ec) ec = save_generations(folder);
     return ec;
 }
 
+// Generations of swapped tables are persisted with heads, so that a reopened
+// or restored store resumes the generations of its tables. A missing file
+// implies a new store, or one closed before generations were persisted.
+TEMPLATE
+code CLASS::load_generations(const path& folder) NOEXCEPT
+{
+    prevout_generation_ = zero;
+    prevout_retired_ = false;
+    set_pool_generation(zero);
+    set_validated_tx_generation(zero);
+
+    const auto marker = folder / schema::marker::generations;
+    if (!file::is_file(marker))
+        return error::success;
+
+    system::data_array<generations_size> data{};
+    if (const auto ec = file::read_file_ex(data.data(), data.size(), marker))
+        return ec;
+
+    system::iostream stream{ data.data(), generations_size };
+    reader source{ stream };
+    prevout_generation_ = system::possible_narrow_cast<size_t>(
+        source.read_8_bytes_little_endian());
+    prevout_retired_ = to_bool(source.read_byte());
+    set_pool_generation(system::possible_narrow_cast<size_t>(
+        source.read_8_bytes_little_endian()));
+    set_validated_tx_generation(system::possible_narrow_cast<size_t>(
+        source.read_8_bytes_little_endian()));
+    return source ? error::success : error::integrity;
+}
+
+TEMPLATE
+code CLASS::save_generations(const path& folder) const NOEXCEPT
+{
+    system::data_array<generations_size> data{};
+    system::iostream stream{ data.data(), generations_size };
+    writer sink{ stream };
+    sink.write_8_bytes_little_endian(prevout_generation_);
+    sink.write_byte(uint8_t{ prevout_retired_ });
+    sink.write_8_bytes_little_endian(pool_generation());
+    sink.write_8_bytes_little_endian(validated_tx_generation());
+    if (!sink)
+        return error::integrity;
+
+    return file::create_file_ex(folder / schema::marker::generations,
+        data.data(), data.size());
+}
+
 TEMPLATE
 code CLASS::restore(const event_handler& handler) NOEXCEPT
 {
+    if (configuration_.read_only)
+        return error::read_only_store;
+
     if (!transactor_mutex_.try_lock())
         return error::transactor_lock;
 
@@ -1096,6 +1791,16 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         ec = error::missing_snapshot;
     }
 
+    // Recover overridden heads from /heads to their own directories.
+    for (const auto& [name, folder]: configuration_.paths)
+    {
+        if (!ec && name.ends_with(schema::ext::head))
+        {
+            /* bool */ file::remove(folder / name);
+            ec = file::copy_ex(heads / name, folder / name);
+        }
+    }
+
     const auto restore = [&handler](code& ec, auto& storage, table_t table) NOEXCEPT
     {
         if (!ec)
@@ -1106,8 +1811,12 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         }
     };
 
-    if (!ec)
-        ec = open_load(handler);
+    // Snapshot heads may precede a table addition or head format change.
+    if (!ec) ec = add_files(handler);
+    if (!ec) ec = open_load(handler);
+
+    add_tables(ec, handler);
+    migrate(ec, handler);
 
     if (!ec)
     {
@@ -1123,15 +1832,29 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         restore(ec, candidate, table_t::candidate_table);
         restore(ec, confirmed, table_t::confirmed_table);
         restore(ec, strong_tx, table_t::strong_tx_table);
+        restore(ec, spent, table_t::spent_table);
+        restore(ec, subroot, table_t::subroot_table);
 
         restore(ec, duplicate, table_t::duplicate_table);
         restore(ec, prevout, table_t::prevout_table);
+        restore(ec, prevout1, table_t::prevout1_table);
         restore(ec, validated_bk, table_t::validated_bk_table);
         restore(ec, validated_tx, table_t::validated_tx_table);
+        restore(ec, validated_tx1, table_t::validated_tx1_table);
 
         restore(ec, address, table_t::address_table);
         restore(ec, filter_bk, table_t::filter_bk_table);
         restore(ec, filter_tx, table_t::filter_tx_table);
+        restore(ec, fee_bk, table_t::fee_bk_table);
+        restore(ec, pool0, table_t::pool0_table);
+        restore(ec, pool1, table_t::pool1_table);
+
+        // Restored bitmap bytes retain bits set since the snapshot (rebuild).
+        if (!ec && !spent.set_complete(false))
+            ec = error::restore_table;
+
+        if (!ec)
+            load_bloom(handler);
 
         if (ec)
             /* code */ unload_close(handler);
@@ -1148,6 +1871,11 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
 
     // store is open after successful restore but not otherwise.
     transactor_mutex_.unlock();
+
+    // Rebuilds take the transactor, store is closed upon failure.
+    if (!ec && (ec = rebuild(handler)))
+        /* code */ close(handler);
+
     return ec;
 }
 
@@ -1172,6 +1900,36 @@ void CLASS::set_dirty() NOEXCEPT
     return dirty_.store(true, std::memory_order_relaxed);
 }
 
+TEMPLATE
+size_t CLASS::pool_generation() const NOEXCEPT
+{
+    return pool_generation_.load(std::memory_order_relaxed);
+}
+
+TEMPLATE
+void CLASS::set_pool_generation(size_t generation) NOEXCEPT
+{
+    pool_generation_.store(generation, std::memory_order_relaxed);
+}
+
+TEMPLATE
+bool CLASS::is_prior_readable() const NOEXCEPT
+{
+    return !configuration_.read_only;
+}
+
+TEMPLATE
+size_t CLASS::validated_tx_generation() const NOEXCEPT
+{
+    return validated_tx_generation_.load(std::memory_order_relaxed);
+}
+
+TEMPLATE
+void CLASS::set_validated_tx_generation(size_t generation) NOEXCEPT
+{
+    validated_tx_generation_.store(generation, std::memory_order_relaxed);
+}
+
 TEMPLATE
 code CLASS::get_fault() const NOEXCEPT
 {
@@ -1187,13 +1945,20 @@ code CLASS::get_fault() const NOEXCEPT
     if ((ec = candidate_body_.get_fault())) return ec;
     if ((ec = confirmed_body_.get_fault())) return ec;
     if ((ec = strong_tx_body_.get_fault())) return ec;
+    if ((ec = spent_body_.get_fault())) return ec;
+    if ((ec = subroot_body_.get_fault())) return ec;
     if ((ec = duplicate_body_.get_fault())) return ec;
     if ((ec = prevout_body_.get_fault())) return ec;
+    if ((ec = prevout1_body_.get_fault())) return ec;
     if ((ec = validated_bk_body_.get_fault())) return ec;
     if ((ec = validated_tx_body_.get_fault())) return ec;
+    if ((ec = validated_tx1_body_.get_fault())) return ec;
     if ((ec = address_body_.get_fault())) return ec;
     if ((ec = filter_bk_body_.get_fault())) return ec;
     if ((ec = filter_tx_body_.get_fault())) return ec;
+    if ((ec = fee_bk_body_.get_fault())) return ec;
+    if ((ec = pool0_body_.get_fault())) return ec;
+    if ((ec = pool1_body_.get_fault())) return ec;
     return ec;
 }
 
@@ -1217,17 +1982,507 @@ size_t CLASS::get_space() const NOEXCEPT
     space(candidate_body_);
     space(confirmed_body_);
     space(strong_tx_body_);
+    space(spent_body_);
+    space(subroot_body_);
     space(duplicate_body_);
     space(prevout_body_);
+    space(prevout1_body_);
     space(validated_bk_body_);
     space(validated_tx_body_);
+    space(validated_tx1_body_);
     space(address_body_);
     space(filter_bk_body_);
     space(filter_tx_body_);
+    space(fee_bk_body_);
+    space(pool0_body_);
+    space(pool1_body_);
 
     return total;
 }
 
+TEMPLATE
+code CLASS::advise(table_t table, advice_t advice, size_t offset,
+    size_t size) NOEXCEPT
+{
+    code ec{ error::success };
+    const auto advise = [&](auto& storage, table_t id) NOEXCEPT
+    {
+        if (!ec && id == table)
+            ec = storage.advise(advice, offset, size);
+    };
+
+    advise(header_head_, table_t::header_head);
+    advise(header_body_, table_t::header_body);
+    advise(input_head_, table_t::input_head);
+    advise(input_body_, table_t::input_body);
+    advise(output_head_, table_t::output_head);
+    advise(output_body_, table_t::output_body);
+    advise(point_head_, table_t::point_head);
+    advise(point_body_, table_t::point_body);
+    advise(ins_head_, table_t::ins_head);
+    advise(ins_body_, table_t::ins_body);
+    advise(outs_head_, table_t::outs_head);
+    advise(outs_body_, table_t::outs_body);
+    advise(tx_head_, table_t::tx_head);
+    advise(tx_body_, table_t::tx_body);
+    advise(txs_head_, table_t::txs_head);
+    advise(txs_body_, table_t::txs_body);
+
+    advise(candidate_head_, table_t::candidate_head);
+    advise(candidate_body_, table_t::candidate_body);
+    advise(confirmed_head_, table_t::confirmed_head);
+    advise(confirmed_body_, table_t::confirmed_body);
+    advise(strong_tx_head_, table_t::strong_tx_head);
+    advise(strong_tx_body_, table_t::strong_tx_body);
+    advise(spent_head_, table_t::spent_head);
+    advise(spent_body_, table_t::spent_body);
+    advise(subroot_head_, table_t::subroot_head);
+    advise(subroot_body_, table_t::subroot_body);
+
+    advise(duplicate_head_, table_t::duplicate_head);
+    advise(duplicate_body_, table_t::duplicate_body);
+    advise(prevout_head_, table_t::prevout_head);
+    advise(prevout_body_, table_t::prevout_body);
+    advise(prevout1_head_, table_t::prevout1_head);
+    advise(prevout1_body_, table_t::prevout1_body);
+    advise(validated_bk_head_, table_t::validated_bk_head);
+    advise(validated_bk_body_, table_t::validated_bk_body);
+    advise(validated_tx_head_, table_t::validated_tx_head);
+    advise(validated_tx_body_, table_t::validated_tx_body);
+    advise(validated_tx1_head_, table_t::validated_tx1_head);
+    advise(validated_tx1_body_, table_t::validated_tx1_body);
+
+    advise(address_head_, table_t::address_head);
+    advise(address_body_, table_t::address_body);
+    advise(filter_bk_head_, table_t::filter_bk_head);
+    advise(filter_bk_body_, table_t::filter_bk_body);
+    advise(filter_tx_head_, table_t::filter_tx_head);
+    advise(filter_tx_body_, table_t::filter_tx_body);
+    advise(fee_bk_head_, table_t::fee_bk_head);
+    advise(fee_bk_body_, table_t::fee_bk_body);
+    advise(pool0_head_, table_t::pool0_head);
+    advise(pool0_body_, table_t::pool0_body);
+    advise(pool1_head_, table_t::pool1_head);
+    advise(pool1_body_, table_t::pool1_body);
+
+    return ec;
+}
+
+TEMPLATE
+code CLASS::advise_initial() NOEXCEPT
+{
+    // Heads are hash tables (random), bodies are append-mostly (sequential).
+    code ec{ error::success };
+    const auto advise = [&ec](auto& head, auto& body) NOEXCEPT
+    {
+        if (!ec) ec = head.advise(advice_t::random);
+        if (!ec) ec = head.advise(advice_t::willneed);
+        if (!ec) ec = body.advise(advice_t::sequential);
+    };
+
+    advise(header_head_, header_body_);
+    advise(input_head_, input_body_);
+    advise(output_head_, output_body_);
+    advise(point_head_, point_body_);
+    advise(ins_head_, ins_body_);
+    advise(outs_head_, outs_body_);
+    advise(tx_head_, tx_body_);
+    advise(txs_head_, txs_body_);
+
+    advise(candidate_head_, candidate_body_);
+    advise(confirmed_head_, confirmed_body_);
+    advise(strong_tx_head_, strong_tx_body_);
+    advise(spent_head_, spent_body_);
+    advise(subroot_head_, subroot_body_);
+
+    advise(duplicate_head_, duplicate_body_);
+    advise(prevout_head_, prevout_body_);
+    advise(prevout1_head_, prevout1_body_);
+    advise(validated_bk_head_, validated_bk_body_);
+    advise(validated_tx_head_, validated_tx_body_);
+    advise(validated_tx1_head_, validated_tx1_body_);
+
+    advise(address_head_, address_body_);
+    advise(filter_bk_head_, filter_bk_body_);
+    advise(filter_tx_head_, filter_tx_body_);
+    advise(fee_bk_head_, fee_bk_body_);
+    advise(pool0_head_, pool0_body_);
+    advise(pool1_head_, pool1_body_);
+
+    return ec;
+}
+
+TEMPLATE
+code CLASS::advise_steady() NOEXCEPT
+{
+    // Bodies are read randomly, with heads and the recent tail retained.
+    constexpr auto tail = system::power2<size_t>(26u);
+    code ec{ error::success };
+    const auto advise = [&ec](auto& head, auto& body) NOEXCEPT
+    {
+        const auto size = body.size();
+        const auto start = size > tail ? size - tail : zero;
+        if (!ec) ec = head.advise(advice_t::random);
+        if (!ec) ec = head.advise(advice_t::willneed);
+        if (!ec) ec = body.advise(advice_t::random);
+        if (!ec) ec = body.advise(advice_t::willneed, start, size - start);
+    };
+
+    advise(header_head_, header_body_);
+    advise(input_head_, input_body_);
+    advise(output_head_, output_body_);
+    advise(point_head_, point_body_);
+    advise(ins_head_, ins_body_);
+    advise(outs_head_, outs_body_);
+    advise(tx_head_, tx_body_);
+    advise(txs_head_, txs_body_);
+
+    advise(candidate_head_, candidate_body_);
+    advise(confirmed_head_, confirmed_body_);
+    advise(strong_tx_head_, strong_tx_body_);
+    advise(spent_head_, spent_body_);
+    advise(subroot_head_, subroot_body_);
+
+    advise(duplicate_head_, duplicate_body_);
+    advise(prevout_head_, prevout_body_);
+    advise(prevout1_head_, prevout1_body_);
+    advise(validated_bk_head_, validated_bk_body_);
+    advise(validated_tx_head_, validated_tx_body_);
+    advise(validated_tx1_head_, validated_tx1_body_);
+
+    advise(address_head_, address_body_);
+    advise(filter_bk_head_, filter_bk_body_);
+    advise(filter_tx_head_, filter_tx_body_);
+    advise(fee_bk_head_, fee_bk_body_);
+    advise(pool0_head_, pool0_body_);
+    advise(pool1_head_, pool1_body_);
+
+    return ec;
+}
+
+TEMPLATE
+code CLASS::prefault(const event_handler& handler) NOEXCEPT
+{
+    struct region
+    {
+        Storage& storage;
+        table_t table;
+        size_t offset;
+        size_t size;
+    };
+
+    std_vector<region> regions{};
+    const auto window = system::limit<size_t>(configuration_.prefault_tail);
+    const auto head = [&regions](Storage& storage, table_t table) NOEXCEPT
+    {
+        regions.push_back({ storage, table, zero, storage.size() });
+    };
+
+    const auto tail = [&](Storage& storage, table_t table) NOEXCEPT
+    {
+        const auto size = storage.size();
+        const auto start = size > window ? size - window : zero;
+        if (!is_zero(window) && !is_zero(size))
+            regions.push_back({ storage, table, start, size - start });
+    };
+
+    head(header_head_, table_t::header_head);
+    head(input_head_, table_t::input_head);
+    head(output_head_, table_t::output_head);
+    head(point_head_, table_t::point_head);
+    head(ins_head_, table_t::ins_head);
+    head(outs_head_, table_t::outs_head);
+    head(tx_head_, table_t::tx_head);
+    head(txs_head_, table_t::txs_head);
+
+    head(candidate_head_, table_t::candidate_head);
+    head(confirmed_head_, table_t::confirmed_head);
+    head(strong_tx_head_, table_t::strong_tx_head);
+    head(spent_head_, table_t::spent_head);
+    head(subroot_head_, table_t::subroot_head);
+
+    head(duplicate_head_, table_t::duplicate_head);
+    head(prevout_head_, table_t::prevout_head);
+    head(prevout1_head_, table_t::prevout1_head);
+    head(validated_bk_head_, table_t::validated_bk_head);
+    head(validated_tx_head_, table_t::validated_tx_head);
+    head(validated_tx1_head_, table_t::validated_tx1_head);
+
+    head(address_head_, table_t::address_head);
+    head(filter_bk_head_, table_t::filter_bk_head);
+    head(filter_tx_head_, table_t::filter_tx_head);
+    head(fee_bk_head_, table_t::fee_bk_head);
+    head(pool0_head_, table_t::pool0_head);
+    head(pool1_head_, table_t::pool1_head);
+
+    tail(header_body_, table_t::header_body);
+    tail(input_body_, table_t::input_body);
+    tail(output_body_, table_t::output_body);
+    tail(point_body_, table_t::point_body);
+    tail(ins_body_, table_t::ins_body);
+    tail(outs_body_, table_t::outs_body);
+    tail(tx_body_, table_t::tx_body);
+    tail(txs_body_, table_t::txs_body);
+
+    tail(candidate_body_, table_t::candidate_body);
+    tail(confirmed_body_, table_t::confirmed_body);
+    tail(strong_tx_body_, table_t::strong_tx_body);
+    tail(spent_body_, table_t::spent_body);
+    tail(subroot_body_, table_t::subroot_body);
+
+    tail(duplicate_body_, table_t::duplicate_body);
+    tail(prevout_body_, table_t::prevout_body);
+    tail(prevout1_body_, table_t::prevout1_body);
+    tail(validated_bk_body_, table_t::validated_bk_body);
+    tail(validated_tx_body_, table_t::validated_tx_body);
+    tail(validated_tx1_body_, table_t::validated_tx1_body);
+
+    tail(address_body_, table_t::address_body);
+    tail(filter_bk_body_, table_t::filter_bk_body);
+    tail(filter_tx_body_, table_t::filter_tx_body);
+    tail(fee_bk_body_, table_t::fee_bk_body);
+    tail(pool0_body_, table_t::pool0_body);
+    tail(pool1_body_, table_t::pool1_body);
+
+    // Each file is prefaulted by a distinct thread (storage is thread safe).
+    // Handler invocations are serialized, as handlers are not thread safe.
+    std::mutex mutex{};
+    constexpr auto parallel = poolstl::execution::par;
+    std_vector<code> codes(regions.size());
+    std::transform(parallel, regions.begin(), regions.end(), codes.begin(),
+        [&](const region& item) NOEXCEPT
+        {
+            {
+                std::lock_guard lock{ mutex };
+                handler(event_t::prefault_file, item.table);
+            }
+
+            return item.storage.advise(advice_t::populate, item.offset,
+                item.size);
+        });
+
+    const auto it = std::find_if_not(codes.begin(), codes.end(),
+        [](const code& ec) NOEXCEPT { return !ec; });
+
+    return it == codes.end() ? error::success : *it;
+}
+
+TEMPLATE
+code CLASS::govern() NOEXCEPT
+{
+    const auto budget = system::limit<size_t>(configuration_.residency_limit);
+    if (is_zero(budget))
+        return error::success;
+
+    // Residency is sampled before enforcement.
+    auto resident = zero;
+    const auto sample = [&resident](const auto& storage) NOEXCEPT
+    {
+        resident = system::ceilinged_add(resident, storage.resident());
+    };
+
+    sample(header_head_);
+    sample(header_body_);
+    sample(input_head_);
+    sample(input_body_);
+    sample(output_head_);
+    sample(output_body_);
+    sample(point_head_);
+    sample(point_body_);
+    sample(ins_head_);
+    sample(ins_body_);
+    sample(outs_head_);
+    sample(outs_body_);
+    sample(tx_head_);
+    sample(tx_body_);
+    sample(txs_head_);
+    sample(txs_body_);
+
+    sample(candidate_head_);
+    sample(candidate_body_);
+    sample(confirmed_head_);
+    sample(confirmed_body_);
+    sample(strong_tx_head_);
+    sample(strong_tx_body_);
+    sample(spent_head_);
+    sample(spent_body_);
+    sample(subroot_head_);
+    sample(subroot_body_);
+
+    sample(duplicate_head_);
+    sample(duplicate_body_);
+    sample(prevout_head_);
+    sample(prevout_body_);
+    sample(prevout1_head_);
+    sample(prevout1_body_);
+    sample(validated_bk_head_);
+    sample(validated_bk_body_);
+    sample(validated_tx_head_);
+    sample(validated_tx_body_);
+    sample(validated_tx1_head_);
+    sample(validated_tx1_body_);
+
+    sample(address_head_);
+    sample(address_body_);
+    sample(filter_bk_head_);
+    sample(filter_bk_body_);
+    sample(filter_tx_head_);
+    sample(filter_tx_body_);
+    sample(fee_bk_head_);
+    sample(fee_bk_body_);
+    sample(pool0_head_);
+    sample(pool0_body_);
+    sample(pool1_head_);
+    sample(pool1_body_);
+
+    code ec{ error::success };
+    auto remaining = budget;
+    const auto reserve = [&remaining](size_t bytes) NOEXCEPT
+    {
+        if (bytes > remaining)
+            return false;
+
+        remaining -= bytes;
+        return true;
+    };
+
+    // Heads first, optionally locked, within budget. A head locked by a prior
+    // pass is unlocked once beyond budget or when locking is not configured.
+    const auto head = [&](auto& storage) NOEXCEPT
+    {
+        if (ec)
+            return;
+
+        const auto size = storage.size();
+        if (!reserve(size))
+        {
+            ec = storage.advise(advice_t::unlock);
+            return;
+        }
+
+        ec = storage.advise(advice_t::willneed, zero, size);
+        if (!ec && configuration_.residency_lock)
+            ec = storage.advise(advice_t::lock, zero, size);
+        else if (!ec)
+            ec = storage.advise(advice_t::unlock);
+    };
+
+    head(header_head_);
+    head(input_head_);
+    head(output_head_);
+    head(point_head_);
+    head(ins_head_);
+    head(outs_head_);
+    head(tx_head_);
+    head(txs_head_);
+
+    head(candidate_head_);
+    head(confirmed_head_);
+    head(strong_tx_head_);
+    head(spent_head_);
+    head(subroot_head_);
+
+    head(duplicate_head_);
+    head(prevout_head_);
+    head(prevout1_head_);
+    head(validated_bk_head_);
+    head(validated_tx_head_);
+    head(validated_tx1_head_);
+
+    head(address_head_);
+    head(filter_bk_head_);
+    head(filter_tx_head_);
+    head(fee_bk_head_);
+    head(pool0_head_);
+    head(pool1_head_);
+
+    // Then index bodies, within budget.
+    const auto index = [&](auto& storage) NOEXCEPT
+    {
+        const auto size = storage.size();
+        if (!ec && reserve(size))
+            ec = storage.advise(advice_t::willneed, zero, size);
+    };
+
+    index(candidate_body_);
+    index(confirmed_body_);
+    index(strong_tx_body_);
+    index(spent_body_);
+    index(subroot_body_);
+
+    // Then recent tails of other bodies, within budget.
+    constexpr auto tail = system::power2<size_t>(26u);
+    const auto warm = [&](auto& storage) NOEXCEPT
+    {
+        const auto size = storage.size();
+        const auto start = size > tail ? size - tail : zero;
+        if (!ec && reserve(size - start))
+            ec = storage.advise(advice_t::willneed, start, size - start);
+    };
+
+    warm(header_body_);
+    warm(input_body_);
+    warm(output_body_);
+    warm(point_body_);
+    warm(ins_body_);
+    warm(outs_body_);
+    warm(tx_body_);
+    warm(txs_body_);
+
+    warm(duplicate_body_);
+    warm(prevout_body_);
+    warm(prevout1_body_);
+    warm(validated_bk_body_);
+    warm(validated_tx_body_);
+    warm(validated_tx1_body_);
+
+    warm(address_body_);
+    warm(filter_bk_body_);
+    warm(filter_tx_body_);
+    warm(fee_bk_body_);
+    warm(pool0_body_);
+    warm(pool1_body_);
+
+    // Remaining body regions are cold, left alone within budget. When over
+    // budget only the excess is paged out, oldest (lowest offset) first.
+    auto excess = resident > budget ? resident - budget : zero;
+    const auto cold = [&](auto& storage) NOEXCEPT
+    {
+        const auto size = storage.size();
+        const auto end = std::min(size > tail ? size - tail : zero, excess);
+        if (!ec && !is_zero(end))
+        {
+            ec = storage.advise(advice_t::pageout, zero, end);
+            excess -= end;
+        }
+    };
+
+    cold(header_body_);
+    cold(input_body_);
+    cold(output_body_);
+    cold(point_body_);
+    cold(ins_body_);
+    cold(outs_body_);
+    cold(tx_body_);
+    cold(txs_body_);
+
+    cold(duplicate_body_);
+    cold(prevout_body_);
+    cold(prevout1_body_);
+    cold(validated_bk_body_);
+    cold(validated_tx_body_);
+    cold(validated_tx1_body_);
+
+    cold(address_body_);
+    cold(filter_bk_body_);
+    cold(filter_tx_body_);
+    cold(fee_bk_body_);
+    cold(pool0_body_);
+    cold(pool1_body_);
+
+    return ec;
+}
+
 TEMPLATE
 void CLASS::report(const error_handler& handler) const NOEXCEPT
 {
@@ -1251,13 +2506,83 @@ void CLASS::report(const error_handler& handler) const NOEXCEPT
     report(candidate_body_, table_t::candidate_body);
     report(confirmed_body_, table_t::confirmed_body);
     report(strong_tx_body_, table_t::strong_tx_body);
+    report(spent_body_, table_t::spent_body);
+    report(subroot_body_, table_t::subroot_body);
+    report(duplicate_body_, table_t::duplicate_body);
+    report(prevout_body_, table_t::prevout_body);
+    report(prevout1_body_, table_t::prevout1_body);
+    report(validated_bk_body_, table_t::validated_bk_body);
+    report(validated_tx_body_, table_t::validated_tx_body);
+    report(validated_tx1_body_, table_t::validated_tx1_body);
+    report(address_body_, table_t::address_body);
+    report(filter_bk_body_, table_t::filter_bk_body);
+    report(filter_tx_body_, table_t::filter_tx_body);
+    report(fee_bk_body_, table_t::fee_bk_body);
+    report(pool0_body_, table_t::pool0_body);
+    report(pool1_body_, table_t::pool1_body);
+}
+
+TEMPLATE
+void CLASS::report(const residency_handler& handler) const NOEXCEPT
+{
+    const auto report = [&handler](const auto& storage, table_t table) NOEXCEPT
+    {
+        handler(storage.resident(), table);
+    };
+
+    report(header_head_, table_t::header_head);
+    report(header_body_, table_t::header_body);
+    report(input_head_, table_t::input_head);
+    report(input_body_, table_t::input_body);
+    report(output_head_, table_t::output_head);
+    report(output_body_, table_t::output_body);
+    report(point_head_, table_t::point_head);
+    report(point_body_, table_t::point_body);
+    report(ins_head_, table_t::ins_head);
+    report(ins_body_, table_t::ins_body);
+    report(outs_head_, table_t::outs_head);
+    report(outs_body_, table_t::outs_body);
+    report(tx_head_, table_t::tx_head);
+    report(tx_body_, table_t::tx_body);
+    report(txs_head_, table_t::txs_head);
+    report(txs_body_, table_t::txs_body);
+
+    report(candidate_head_, table_t::candidate_head);
+    report(candidate_body_, table_t::candidate_body);
+    report(confirmed_head_, table_t::confirmed_head);
+    report(confirmed_body_, table_t::confirmed_body);
+    report(strong_tx_head_, table_t::strong_tx_head);
+    report(strong_tx_body_, table_t::strong_tx_body);
+    report(spent_head_, table_t::spent_head);
+    report(spent_body_, table_t::spent_body);
+    report(subroot_head_, table_t::subroot_head);
+    report(subroot_body_, table_t::subroot_body);
+
+    report(duplicate_head_, table_t::duplicate_head);
     report(duplicate_body_, table_t::duplicate_body);
+    report(prevout_head_, table_t::prevout_head);
     report(prevout_body_, table_t::prevout_body);
+    report(prevout1_head_, table_t::prevout1_head);
+    report(prevout1_body_, table_t::prevout1_body);
+    report(validated_bk_head_, table_t::validated_bk_head);
     report(validated_bk_body_, table_t::validated_bk_body);
+    report(validated_tx_head_, table_t::validated_tx_head);
     report(validated_tx_body_, table_t::validated_tx_body);
+    report(validated_tx1_head_, table_t::validated_tx1_head);
+    report(validated_tx1_body_, table_t::validated_tx1_body);
+
+    report(address_head_, table_t::address_head);
     report(address_body_, table_t::address_body);
+    report(filter_bk_head_, table_t::filter_bk_head);
     report(filter_bk_body_, table_t::filter_bk_body);
+    report(filter_tx_head_, table_t::filter_tx_head);
     report(filter_tx_body_, table_t::filter_tx_body);
+    report(fee_bk_head_, table_t::fee_bk_head);
+    report(fee_bk_body_, table_t::fee_bk_body);
+    report(pool0_head_, table_t::pool0_head);
+    report(pool0_body_, table_t::pool0_body);
+    report(pool1_head_, table_t::pool1_head);
+    report(pool1_body_, table_t::pool1_body);
 }
 
 BC_POP_WARNING()
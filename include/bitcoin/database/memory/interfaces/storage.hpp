@@ -26,6 +26,21 @@
 namespace libbitcoin {
 namespace database {
 
+/// Memory map access advice (madvise/mlock), ignored where unsupported.
+enum class advice_t
+{
+    normal,
+    random,
+    sequential,
+    willneed,
+    dontneed,
+    cold,
+    pageout,
+    populate,
+    lock,
+    unlock
+};
+
 /// Mapped memory interface.
 class storage
 {
@@ -92,6 +107,15 @@ public:
 
     /// Get the space required to clear the disk full condition.
     virtual size_t get_space() const NOEXCEPT = 0;
+
+    /// Advise access to the byte range, clamped to capacity (must be loaded).
+    /// Whole-map normal/random/sequential advice is retained across remaps.
+    virtual code advise(advice_t advice, size_t offset=zero,
+        size_t size=eof) NOEXCEPT = 0;
+
+    /// Bytes of the memory map resident in physical memory (zero if unloaded
+    /// or unsupported).
+    virtual size_t resident() const NOEXCEPT = 0;
 };
 
 } // namespace database
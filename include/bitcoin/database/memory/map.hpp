@@ -40,8 +40,9 @@ class BCD_API map
 public:
     DELETE_COPY_MOVE(map);
 
+    /// Read-only maps follow the file size of a concurrent writer process.
     map(const std::filesystem::path& filename, size_t minimum=1,
-        size_t expansion=0, bool random=true) NOEXCEPT;
+        size_t expansion=0, bool random=true, bool read_only=false) NOEXCEPT;
 
     /// Destruct for debug assertion only.
     virtual ~map() NOEXCEPT;
@@ -117,6 +118,15 @@ public:
     /// Use load() to clear the indicated space and allow restart.
     size_t get_space() const NOEXCEPT override;
 
+    /// Advise access to the byte range, clamped to capacity (must be loaded).
+    /// Whole-map normal/random/sequential advice is retained across remaps.
+    code advise(advice_t advice, size_t offset=zero,
+        size_t size=eof) NOEXCEPT override;
+
+    /// Bytes of the memory map resident in physical memory (zero if unloaded
+    /// or unsupported).
+    size_t resident() const NOEXCEPT override;
+
 protected:
     size_t to_capacity(size_t required) const NOEXCEPT;
     void set_first_code(const error::error_t& ec) NOEXCEPT;
@@ -139,6 +149,7 @@ private:
     const size_t minimum_;
     const size_t expansion_;
     const bool random_;
+    const bool read_only_;
 
     // Protected by remap_mutex.
     // requires remap_mutex_ exclusive lock for write.
@@ -158,6 +169,7 @@ private:
 
     // These are thread safe.
     std::atomic<size_t> space_{ zero };
+    std::atomic<advice_t> pattern_;
     std::atomic<error::error_t> error_{ error::success };
 };
 
@@ -54,6 +54,9 @@ public:
     bool restore() NOEXCEPT;
     bool verify() const NOEXCEPT;
 
+    /// Set body count to that last published in head (read-only attach).
+    bool follow() NOEXCEPT;
+
     /// Sizing.
     /// -----------------------------------------------------------------------
 
@@ -107,6 +110,14 @@ public:
     template <typename Element, if_equal<Element::size, RowSize> = true>
     inline bool get(const Link& link, Element& element) const NOEXCEPT;
 
+    /// Return ptr for batch processing, holds shared lock on storage remap.
+    inline memory_ptr get_memory() const NOEXCEPT;
+
+    /// Get element at link using get_memory() ptr, false if deserialize error.
+    template <typename Element, if_equal<Element::size, RowSize> = true>
+    static bool get(const memory_ptr& ptr, const Link& link,
+        Element& element) NOEXCEPT;
+
     /// Allocate, set, commit element to key.
     /// Expands table AND HEADER as necessary.
     template <typename Element, if_equal<Element::size, RowSize> = true>
@@ -57,6 +57,25 @@ public:
     bool get_body_count(Link& count) const NOEXCEPT;
     bool set_body_count(const Link& count) NOEXCEPT;
 
+    /// True if head file size is that of cells of the given size.
+    bool is_sized(size_t cell) const NOEXCEPT;
+
+    /// Recreate empty head from head of the given cell size, obtaining its
+    /// body count and leaving terminal body count (not thread safe). An
+    /// interrupted migration is restarted, obtaining terminal body count.
+    bool migrate(Link& count, size_t cell) NOEXCEPT;
+
+    /// True if head is of cell size with terminal body count (interrupted).
+    bool is_migrating() const NOEXCEPT;
+
+    /// Recreate empty head, with zero body count (not thread safe).
+    bool reset() NOEXCEPT;
+
+    /// Probe sampled occupied buckets with synthetic entropy, counting those
+    /// rejected by the filter (bypassing body search) of total probes.
+    void sample_filter(size_t& rejects, size_t& probes,
+        size_t samples) const NOEXCEPT;
+
     /// Convert natural key to head bucket index (all keys are valid).
     /// Terminal is a valid bucket index (just not a valid bucket value).
     inline Link index(const Key& key) const NOEXCEPT;
@@ -57,6 +57,21 @@ public:
     bool restore() NOEXCEPT;
     bool verify() const NOEXCEPT;
 
+    /// Set body count to that last published in head (read-only attach).
+    bool follow() NOEXCEPT;
+
+    /// True if head is sized for cells of the given (other) size, or if a
+    /// migration from it was interrupted.
+    bool is_legacy(size_t cell) const NOEXCEPT;
+
+    /// Rebuild head from body keys, given head of legacy cell size. Only the
+    /// head's body count of records is indexed (records only). Resumes an
+    /// interrupted migration, indexing all body records.
+    bool migrate(size_t cell) NOEXCEPT;
+
+    /// Remove all elements, retaining bucket count (not thread safe).
+    bool reset() NOEXCEPT;
+
     /// Sizing.
     /// -----------------------------------------------------------------------
 
@@ -90,6 +105,10 @@ public:
     /// Count of puts not resulting in table body search to detect duplication.
     size_t negative_search_count() const NOEXCEPT;
 
+    /// Probes of sampled occupied buckets, and count rejected by head filter.
+    void sample_filter(size_t& rejects, size_t& probes,
+        size_t samples) const NOEXCEPT;
+
     /// Errors.
     /// -----------------------------------------------------------------------
 
@@ -129,6 +148,9 @@ public:
     /// Return the associated search key (terminal link returns default).
     Key get_key(const Link& link) NOEXCEPT;
 
+    /// Return the associated search key using get_memory() ptr.
+    static Key get_key(const memory_ptr& ptr, const Link& link) NOEXCEPT;
+
     /// Get first element matching the search key, false if not found/error.
     template <typename Element, if_equal<Element::size, RowSize> = true>
     inline bool find(const Key& key, Element& element) const NOEXCEPT;
@@ -40,6 +40,9 @@ public:
 
     nomap(storage& header, storage& body) NOEXCEPT;
 
+    /// Head cells follow the body count, for table state (see at/push).
+    nomap(storage& header, storage& body, const Link& buckets) NOEXCEPT;
+
     /// Setup, not thread safe.
     /// -----------------------------------------------------------------------
 
@@ -49,6 +52,9 @@ public:
     bool restore() NOEXCEPT;
     bool verify() const NOEXCEPT;
 
+    /// Set body count to that last published in head (read-only attach).
+    bool follow() NOEXCEPT;
+
     /// Sizing.
     /// -----------------------------------------------------------------------
 
@@ -88,12 +94,21 @@ public:
     /// Query interface.
     /// -----------------------------------------------------------------------
 
+    /// Head cell value at index, terminal if not set.
+    inline Link at(size_t index) const NOEXCEPT;
+
+    /// Set head cell value at index, expands header as necessary.
+    inline bool push(const Link& value, size_t index) NOEXCEPT;
+
     /// Reserve additional count or slab to guard against disk full.
     /// This is necessary for no-maps that are publicly-indexed (e.g. heights).
     /// Not writer-writer thread safe. Link must be put (or discarded) before
     /// any subsequent element is reserved or put, or will overwrite.
     inline bool reserve(const Link& size) NOEXCEPT;
 
+    /// Allocate count or slab size at returned link (follow with put).
+    inline Link allocate(const Link& size) NOEXCEPT;
+
     /// Return ptr for batch processing, holds shared lock on storage remap.
     inline memory_ptr get_memory() const NOEXCEPT;
 
@@ -116,6 +131,12 @@ public:
     template <typename Element, if_equal<Element::size, Size> = true>
     bool put(const memory_ptr& ptr, const Element& element) NOEXCEPT;
 
+    /// Put previously allocated element at link using get_memory() ptr.
+    /// Thread safe for distinct links, allocation must precede get_memory().
+    template <typename Element, if_equal<Element::size, Size> = true>
+    static bool put(const memory_ptr& ptr, const Link& link,
+        const Element& element) NOEXCEPT;
+
     /// Put element and return link.
     template <typename Element, if_equal<Element::size, Size> = true>
     inline bool put_link(Link& link, const Element& element) NOEXCEPT;
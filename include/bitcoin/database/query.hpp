@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_HPP
 #define LIBBITCOIN_DATABASE_QUERY_HPP
 
+#include <chrono>
 #include <mutex>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/settings.hpp>
@@ -90,6 +91,11 @@ public:
     /// Count of puts not resulting in table body search to detect duplication.
     size_t negative_search_count() const NOEXCEPT;
 
+    /// Probes of sampled occupied address buckets, and count rejected by the
+    /// head filter (rejects/probes approximates screened unused addresses).
+    void get_address_screening(size_t& rejects, size_t& probes,
+        size_t samples=1024) const NOEXCEPT;
+
     /// Store extent.
     /// -----------------------------------------------------------------------
 
@@ -116,12 +122,19 @@ public:
     size_t candidate_head_size() const NOEXCEPT;
     size_t confirmed_head_size() const NOEXCEPT;
     size_t strong_tx_head_size() const NOEXCEPT;
+    size_t spent_head_size() const NOEXCEPT;
+    size_t subroot_head_size() const NOEXCEPT;
     size_t duplicate_head_size() const NOEXCEPT;
     size_t prevout_head_size() const NOEXCEPT;
+    size_t prevout1_head_size() const NOEXCEPT;
     size_t validated_bk_head_size() const NOEXCEPT;
     size_t validated_tx_head_size() const NOEXCEPT;
+    size_t validated_tx1_head_size() const NOEXCEPT;
     size_t filter_bk_head_size() const NOEXCEPT;
     size_t filter_tx_head_size() const NOEXCEPT;
+    size_t fee_bk_head_size() const NOEXCEPT;
+    size_t pool0_head_size() const NOEXCEPT;
+    size_t pool1_head_size() const NOEXCEPT;
     size_t address_head_size() const NOEXCEPT;
 
     /// Table body logical byte sizes.
@@ -137,12 +150,19 @@ public:
     size_t candidate_body_size() const NOEXCEPT;
     size_t confirmed_body_size() const NOEXCEPT;
     size_t strong_tx_body_size() const NOEXCEPT;
+    size_t spent_body_size() const NOEXCEPT;
+    size_t subroot_body_size() const NOEXCEPT;
     size_t duplicate_body_size() const NOEXCEPT;
     size_t prevout_body_size() const NOEXCEPT;
+    size_t prevout1_body_size() const NOEXCEPT;
     size_t validated_bk_body_size() const NOEXCEPT;
     size_t validated_tx_body_size() const NOEXCEPT;
+    size_t validated_tx1_body_size() const NOEXCEPT;
     size_t filter_bk_body_size() const NOEXCEPT;
     size_t filter_tx_body_size() const NOEXCEPT;
+    size_t fee_bk_body_size() const NOEXCEPT;
+    size_t pool0_body_size() const NOEXCEPT;
+    size_t pool1_body_size() const NOEXCEPT;
     size_t address_body_size() const NOEXCEPT;
 
     /// Table (head + body) logical byte sizes.
@@ -158,12 +178,19 @@ public:
     size_t candidate_size() const NOEXCEPT;
     size_t confirmed_size() const NOEXCEPT;
     size_t strong_tx_size() const NOEXCEPT;
+    size_t spent_size() const NOEXCEPT;
+    size_t subroot_size() const NOEXCEPT;
     size_t duplicate_size() const NOEXCEPT;
     size_t prevout_size() const NOEXCEPT;
+    size_t prevout1_size() const NOEXCEPT;
     size_t validated_bk_size() const NOEXCEPT;
     size_t validated_tx_size() const NOEXCEPT;
+    size_t validated_tx1_size() const NOEXCEPT;
     size_t filter_bk_size() const NOEXCEPT;
     size_t filter_tx_size() const NOEXCEPT;
+    size_t fee_bk_size() const NOEXCEPT;
+    size_t pool0_size() const NOEXCEPT;
+    size_t pool1_size() const NOEXCEPT;
     size_t address_size() const NOEXCEPT;
 
     /// Buckets (hashmap + arraymap).
@@ -175,10 +202,15 @@ public:
     size_t strong_tx_buckets() const NOEXCEPT;
     size_t duplicate_buckets() const NOEXCEPT;
     size_t prevout_buckets() const NOEXCEPT;
+    size_t prevout1_buckets() const NOEXCEPT;
     size_t validated_bk_buckets() const NOEXCEPT;
     size_t validated_tx_buckets() const NOEXCEPT;
+    size_t validated_tx1_buckets() const NOEXCEPT;
     size_t filter_bk_buckets() const NOEXCEPT;
     size_t filter_tx_buckets() const NOEXCEPT;
+    size_t fee_bk_buckets() const NOEXCEPT;
+    size_t pool0_buckets() const NOEXCEPT;
+    size_t pool1_buckets() const NOEXCEPT;
     size_t address_buckets() const NOEXCEPT;
 
     /// Records.
@@ -191,8 +223,11 @@ public:
     size_t candidate_records() const NOEXCEPT;
     size_t confirmed_records() const NOEXCEPT;
     size_t strong_tx_records() const NOEXCEPT;
+    size_t spent_records() const NOEXCEPT;
+    size_t subroot_records() const NOEXCEPT;
     size_t duplicate_records() const NOEXCEPT;
     size_t filter_bk_records() const NOEXCEPT;
+    size_t fee_bk_records() const NOEXCEPT;
     size_t address_records() const NOEXCEPT;
 
     /// Counters (archive slabs - txs/puts/filter_tx can be derived).
@@ -206,6 +241,8 @@ public:
     /// Optional/configured table state.
     bool address_enabled() const NOEXCEPT;
     bool filter_enabled() const NOEXCEPT;
+    bool fee_enabled() const NOEXCEPT;
+    bool pool_enabled() const NOEXCEPT;
     size_t interval_span() const NOEXCEPT;
 
     /// Initialization (natural-keyed).
@@ -304,6 +341,7 @@ public:
     constexpr size_t to_validated_bk(const header_link& link) const NOEXCEPT;
     constexpr size_t to_filter_bk(const header_link& link) const NOEXCEPT;
     constexpr size_t to_filter_tx(const header_link& link) const NOEXCEPT;
+    constexpr size_t to_fee_bk(const header_link& link) const NOEXCEPT;
     constexpr size_t to_prevout(const header_link& link) const NOEXCEPT;
     constexpr size_t to_txs(const header_link& link) const NOEXCEPT;
 
@@ -390,7 +428,41 @@ public:
 
     data_chunk get_wire_header(const header_link& link) const NOEXCEPT;
     data_chunk get_wire_tx(const tx_link& link, bool witness) const NOEXCEPT;
-    data_chunk get_wire_block(const header_link& link, bool witness) const NOEXCEPT;
+    data_chunk get_wire_block(const header_link& link, bool witness,
+        bool turbo=false) const NOEXCEPT;
+
+    /// Shared encodings from the wire cache (see settings.wire_cache_limit).
+    /// Cache is populated on miss if enabled, empty pointer implies failure.
+    wire_cache::chunk_cptr get_cached_wire_header(
+        const header_link& link) const NOEXCEPT;
+    wire_cache::chunk_cptr get_cached_wire_block(const header_link& link,
+        bool witness, bool turbo=false) const NOEXCEPT;
+    wire_cache::metrics get_wire_cache_metrics() const NOEXCEPT;
+
+    /// Segments reference mapped store memory (guarded), release promptly.
+    bool get_wire_tx(wire_segments& out, const tx_link& link,
+        bool witness) const NOEXCEPT;
+    bool get_wire_block(wire_segments& out, const header_link& link,
+        bool witness) const NOEXCEPT;
+
+    /// Compact blocks (BIP152).
+    /// -----------------------------------------------------------------------
+
+    /// SipHash key of a compact block from its archived header and nonce.
+    bool get_short_id_key(short_ids::key& out, const header_link& link,
+        uint64_t nonce) const NOEXCEPT;
+
+    /// Sorted short id map over recently archived and pooled unconfirmed txs
+    /// (see settings.short_id_limit), built in parallel and cached per key.
+    short_ids::map_cptr get_short_ids(const short_ids::key& key) const NOEXCEPT;
+
+    /// Recent archived txs with the short id, more than one is collision.
+    tx_links to_short_id_txs(const short_ids::key& key,
+        uint64_t id) const NOEXCEPT;
+
+    /// Recent pooled txs with the short id, more than one is collision.
+    transactions get_short_id_pooled(const short_ids::key& key,
+        uint64_t id) const NOEXCEPT;
 
     /// Objects.
     /// -----------------------------------------------------------------------
@@ -398,10 +470,11 @@ public:
     inputs_ptr get_inputs(const tx_link& link, bool witness) const NOEXCEPT;
     outputs_ptr get_outputs(const tx_link& link) const NOEXCEPT;
     transactions_ptr get_transactions(const header_link& link,
-        bool witness) const NOEXCEPT;
+        bool witness, bool turbo=false) const NOEXCEPT;
 
     header::cptr get_header(const header_link& link) const NOEXCEPT;
-    block::cptr get_block(const header_link& link, bool witness) const NOEXCEPT;
+    block::cptr get_block(const header_link& link, bool witness,
+        bool turbo=false) const NOEXCEPT;
     transaction::cptr get_transaction(const tx_link& link,
         bool witness) const NOEXCEPT;
 
@@ -446,6 +519,16 @@ public:
     bool get_branch_fees(const stopper& cancel, fee_rate_sets& out, size_t start,
         size_t count) const NOEXCEPT;
 
+    /// Fee rate histograms by block or confirmed branch (see fee_enabled).
+    bool get_fee_histogram(fee_histogram& out,
+        const header_link& link) const NOEXCEPT;
+    bool get_branch_fee_histograms(fee_histograms& out, size_t start,
+        size_t count) const NOEXCEPT;
+
+    /// Set histogram from block with populated prevouts (i.e. confirmed).
+    bool set_fee_histogram(const header_link& link,
+        const block& block) NOEXCEPT;
+
     /// Merkle.
     /// -----------------------------------------------------------------------
 
@@ -454,6 +537,29 @@ public:
     code get_merkle_root_and_proof(hash_digest& root, hashes& proof,
         size_t target, size_t checkpoint) const NOEXCEPT;
 
+    /// Merkle branch of a strong tx and its position in the block. Block
+    /// trees are cached (see settings.merkle_cache_limit).
+    bool get_tx_merkle_branch(hashes& out, size_t& position,
+        const tx_link& link) const NOEXCEPT;
+    wire_cache::metrics get_merkle_cache_metrics() const NOEXCEPT;
+
+    /// Rebuild the interval subroot cache over confirmed blocks (see open).
+    code rebuild_subroot(const stopper& cancel) NOEXCEPT;
+
+    /// Pool (unconfirmed txs, see pool_enabled).
+    /// -----------------------------------------------------------------------
+
+    /// Pooled txs are held apart from the archive in two generations (tables).
+    /// A pooled tx is archived (promoted) when its block is archived, and its
+    /// pooled copy is dropped by subsequent rotations. Rotation empties the
+    /// prior generation and makes it current. This occurs when the current
+    /// generation body reaches settings.pool_limit, or when called (by age).
+    bool is_pooled(const hash_digest& key) const NOEXCEPT;
+    transaction::cptr get_pooled_transaction(
+        const hash_digest& key) const NOEXCEPT;
+    bool set_pooled(const transaction& tx) NOEXCEPT;
+    bool rotate_pool() NOEXCEPT;
+
     /// Archive writes.
     /// -----------------------------------------------------------------------
 
@@ -482,6 +588,10 @@ public:
     code set_code(header_link& out_fk, const header& header,
         const chain_context& ctx, bool milestone, bool=false) NOEXCEPT;
 
+    /// Set headers (headers-first batch), each parent archived or preceding.
+    code set_code(header_links& out_fks,
+        const header_entries& entries) NOEXCEPT;
+
     /// Set full block (blocks-first).
     code set_code(const block& block, const context& ctx, bool milestone,
         bool strong) NOEXCEPT;
@@ -545,6 +655,9 @@ public:
     bool set_tx_connected(const tx_link& link, const context& ctx,
         uint64_t fee, size_t sigops) NOEXCEPT;
 
+    /// Drop tx states below settings.validated_tx_window of the top candidate.
+    bool rotate_validated_tx() NOEXCEPT;
+
     /// Confirmation.
     /// -----------------------------------------------------------------------
     /// These are not used in consensus confirmation.
@@ -558,8 +671,16 @@ public:
     bool is_confirmed_all_prevouts(const tx_link& link) const NOEXCEPT;
     bool is_unconfirmed_spent(const output_link& link) const NOEXCEPT;
     bool is_confirmed_spent(const output_link& link) const NOEXCEPT;
+    bool is_confirmed_spent(const tx_link& link,
+        uint32_t index) const NOEXCEPT;
     bool is_spent(const output_link& link) const NOEXCEPT;
 
+    /// Confirmed-spent bitmap (outs record ordinal), see rebuild_spent.
+    outs_link to_outs(const output_link& link) const NOEXCEPT;
+    outs_link to_outs(const tx_link& link, uint32_t index) const NOEXCEPT;
+    bool is_spent_bit(const outs_link& link) const NOEXCEPT;
+    code rebuild_spent(const stopper& cancel) NOEXCEPT;
+
     /// Height index not used by these.
     bool is_strong_tx(const tx_link& link) const NOEXCEPT;
     bool is_strong_block(const header_link& link) const NOEXCEPT;
@@ -606,12 +727,24 @@ public:
     bool pop_candidate() NOEXCEPT;
     bool pop_confirmed() NOEXCEPT;
 
+    /// Range push/pop, all heights in one transaction and contiguous write.
+    bool push_candidate(const header_links& links) NOEXCEPT;
+    bool push_confirmed(const header_links& links, bool strong) NOEXCEPT;
+    bool pop_candidate(size_t count) NOEXCEPT;
+    bool pop_confirmed(size_t count) NOEXCEPT;
+
     /// Populate message payloads from locator.
     headers get_headers(const hashes& locator, const hash_digest& stop,
         size_t limit) const NOEXCEPT;
     hashes get_blocks(const hashes& locator, const hash_digest& stop,
         size_t limit) const NOEXCEPT;
 
+    /// Serialized 80 byte headers from locator, without chain objects.
+    bool get_wire_headers(bytewriter& sink, const hashes& locator,
+        const hash_digest& stop, size_t limit) const NOEXCEPT;
+    data_chunk get_wire_headers(const hashes& locator, const hash_digest& stop,
+        size_t limit) const NOEXCEPT;
+
     /// Get descending list of ancestry starting with descendant (inclusive).
     bool get_ancestry(header_links& ancestry, const header_link& descendant,
         size_t count) const NOEXCEPT;
@@ -668,12 +801,29 @@ public:
     bool get_filter_heads(hashes& filter_heads, size_t stop_height,
         size_t interval) const NOEXCEPT;
 
+    /// Confirmed range readers, false if any height unconfirmed or unfiltered.
+    /// Hashes are for [start, start + count), heads for each interval from
+    /// start. Wire forms are compact-size prefixed (cfheaders/cfcheckpt).
+    bool get_confirmed_filter_hashes(hashes& filter_hashes,
+        hash_digest& previous_header, size_t start, size_t count) const NOEXCEPT;
+    bool get_confirmed_filter_heads(hashes& filter_heads, size_t start,
+        size_t count, size_t interval=one) const NOEXCEPT;
+    bool get_wire_filter_hashes(data_chunk& out, hash_digest& previous_header,
+        size_t start, size_t count) const NOEXCEPT;
+    bool get_wire_filter_heads(data_chunk& out, size_t start, size_t count,
+        size_t interval=one) const NOEXCEPT;
+
     bool set_filter_body(const header_link& link, const block& block) NOEXCEPT;
     bool set_filter_body(const header_link& link, const filter& body) NOEXCEPT;
     bool set_filter_head(const header_link& link) NOEXCEPT;
     bool set_filter_head(const header_link& link, const hash_digest& head,
         const hash_digest& hash) NOEXCEPT;
 
+    /// Compute filters for confirmed blocks above the top filtered height,
+    /// in batches separated by pause (resumable, see get_first_unfiltered).
+    code backfill_filters(const stopper& cancel, size_t batch=1024,
+        const std::chrono::milliseconds& pause={}) NOEXCEPT;
+
 protected:
     /// Network
     /// -----------------------------------------------------------------------
@@ -681,6 +831,9 @@ protected:
     /// Height of highest confirmed block (assumes locator descending).
     size_t get_locator_start(const hashes& locator) const NOEXCEPT;
 
+    /// Serialized headers for the confirmed span (end must not exceed top).
+    bool get_wire_headers(bytewriter& sink, const span& range) const NOEXCEPT;
+
     /// Height of highest confirmed block (assumes locator descending).
     span get_locator_span(const hashes& locator, const hash_digest& stop,
         size_t limit) const NOEXCEPT;
@@ -726,6 +879,12 @@ protected:
     bool is_confirmed_unspent(const output_link& link) const NOEXCEPT;
     bool is_unconfirmed_unspent(const output_link& link) const NOEXCEPT;
 
+    /// Confirmed-spent bitmap maintenance (set under transactor).
+    outs_link to_prevout_outs(const point_link& link) const NOEXCEPT;
+    outs_links to_block_spent_outs(const header_link& link) const NOEXCEPT;
+    bool expand_spent(size_t bytes) NOEXCEPT;
+    bool set_spent(const outs_links& outs, bool spent) NOEXCEPT;
+
     /// Consensus.
     /// -----------------------------------------------------------------------
 
@@ -745,6 +904,9 @@ protected:
     /// Support set_strong and set_unstrong writers.
     bool set_strong(const header_link& link, size_t count,
         const tx_link& first_fk, bool positive) NOEXCEPT;
+    bool set_strong(const memory_ptr& ptr, strong_link& record,
+        const header_link& link, size_t count, const tx_link& first_fk,
+        bool positive) NOEXCEPT;
 
     /// Get all tx links for any point of block that is also in duplicate table.
     bool get_doubles(tx_links& out, const block& block) const NOEXCEPT;
@@ -798,6 +960,11 @@ protected:
         size_t lift) NOEXCEPT;
     static positions merkle_branch(size_t leaf, size_t leaves,
         bool compress=false) NOEXCEPT;
+    static size_t merkle_tree_size(size_t leaves) NOEXCEPT;
+
+    // block merkle trees (all levels, leaves first), cached on read
+    wire_cache::chunk_cptr get_merkle_tree(
+        const header_link& link) const NOEXCEPT;
 
     // merkle related configuration
     size_t interval_depth() const NOEXCEPT;
@@ -806,14 +973,71 @@ protected:
     hash_option get_confirmed_interval(size_t height) const NOEXCEPT;
     hash_option create_interval(header_link link, size_t height) const NOEXCEPT;
     code get_merkle_subroots(hashes& roots, size_t waypoint) const NOEXCEPT;
+    code get_merkle_subroot(hash_digest& root, size_t first,
+        size_t waypoint) const NOEXCEPT;
     code get_merkle_proof(hashes& proof, hashes roots, size_t target,
         size_t waypoint) const NOEXCEPT;
+    code get_merkle_interval_proof(hashes& proof, size_t target,
+        size_t waypoint) const NOEXCEPT;
+
+    // merkle mountain range of complete interval roots (subroot table)
+    bool is_subroot_cached(size_t waypoint) const NOEXCEPT;
+    code get_merkle_cached(hash_digest& root, hashes& proof, size_t target,
+        size_t waypoint) const NOEXCEPT;
+    code get_merkle_cached_root(hash_digest& root, hash_digest& last,
+        size_t waypoint) const NOEXCEPT;
+    code get_merkle_node(hash_digest& out, size_t level, size_t index,
+        size_t complete, size_t count, const hash_digest& last) const NOEXCEPT;
+    bool push_subroot(const header_link& link, size_t height) NOEXCEPT;
+    bool pop_subroot(size_t height) NOEXCEPT;
+
+    /// Filters.
+    /// -----------------------------------------------------------------------
+
+    size_t get_first_unfiltered() const NOEXCEPT;
+    bool get_confirmed_filters(uint8_t* data, size_t start, size_t count,
+        size_t interval, bool heads) const NOEXCEPT;
+
+    /// Wire (data must be sized to tx wire size, see get_wire_block).
+    /// -----------------------------------------------------------------------
+    bool get_wire_tx(uint8_t* data, size_t size, const tx_link& link,
+        bool witness) const NOEXCEPT;
+
+    /// Bypass the wire cache.
+    data_chunk get_wire_header_(const header_link& link) const NOEXCEPT;
+    data_chunk get_wire_block_(const header_link& link, bool witness,
+        bool turbo) const NOEXCEPT;
+    bool get_wire_segments(wire_segments& out, const header_link& link,
+        const tx_links& txs, bool witness) const NOEXCEPT;
+
+    /// Pool.
+    /// -----------------------------------------------------------------------
+    static constexpr uint64_t pooled_flag = uint64_t{ 1 } << 63;
+    static constexpr auto pooled_shift = table::pool::link::bits;
+    static constexpr uint64_t pooled_generations =
+        system::sub1(pooled_flag >> pooled_shift);
+    static uint64_t to_pooled_reference(size_t generation,
+        const table::pool::link& link) NOEXCEPT;
+    static bool is_pooled_reference(uint64_t reference) NOEXCEPT;
+    transaction::cptr get_pooled_reference(uint64_t reference) const NOEXCEPT;
+    table::pool& to_pool(size_t generation) const NOEXCEPT;
+    bool rotate_pool(size_t generation) NOEXCEPT;
+
+    /// Validated tx generations.
+    /// -----------------------------------------------------------------------
+    table::validated_tx& to_validated_tx(size_t generation) const NOEXCEPT;
+    bool copy_validated_tx(table::validated_tx& from, table::validated_tx& to,
+        size_t floor) NOEXCEPT;
 
     /// tx_fk must be allocated.
     /// -----------------------------------------------------------------------
     code set_code(const tx_link& tx_fk, const transaction& tx,
         bool bypass) NOEXCEPT;
 
+    /// tx_fks must be allocated for all txs of the block (contiguous).
+    code set_code(const tx_link& tx_fks, const block& block,
+        bool bypass) NOEXCEPT;
+
 private:
     // This value should never be read, but may be useful in debugging.
     static constexpr uint32_t unspecified_timestamp = max_uint32;
@@ -842,6 +1066,12 @@ private:
     mutable std::shared_mutex candidate_reorganization_mutex_{};
     mutable std::shared_mutex confirmed_reorganization_mutex_{};
     mutable std::atomic<size_t> span_{};
+    mutable std::shared_mutex pool_mutex_{};
+    std::mutex pool_insert_mutex_{};
+    mutable std::shared_mutex validated_tx_mutex_{};
+    mutable wire_cache wire_cache_;
+    mutable wire_cache merkle_cache_;
+    mutable short_ids short_ids_;
     Store& store_;
 };
 
@@ -889,11 +1119,13 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 #include <bitcoin/database/impl/query/initialize.ipp>
 #include <bitcoin/database/impl/query/locator.ipp>
 #include <bitcoin/database/impl/query/merkle.ipp>
+#include <bitcoin/database/impl/query/pool.ipp>
 #include <bitcoin/database/impl/query/properties_block.ipp>
 #include <bitcoin/database/impl/query/properties_tx.ipp>
 #include <bitcoin/database/impl/query/query.ipp>
 #include <bitcoin/database/impl/query/sequences.ipp>
 #include <bitcoin/database/impl/query/sizes.ipp>
+#include <bitcoin/database/impl/query/spent.ipp>
 
 BC_POP_WARNING()
 
@@ -22,6 +22,8 @@
 #include <bitcoin/database/define.hpp>
 
 #include <filesystem>
+#include <string>
+#include <unordered_map>
 
 namespace libbitcoin {
 namespace database {
@@ -45,9 +47,38 @@ struct BCD_API settings
     /// Depth of electrum merkle tree interval caching.
     uint16_t interval_depth{ max_uint8 };
 
+    /// Memory budget (bytes) of the wire block/header cache (zero disables).
+    uint64_t wire_cache_limit{ 0 };
+
+    /// Memory budget (bytes) of the block merkle tree cache (zero disables).
+    uint64_t merkle_cache_limit{ 0 };
+
+    /// Memory budget (bytes) of the tx hash negative lookup filter.
+    uint64_t tx_bloom_limit{ 0 };
+
+    /// Count of recent unconfirmed txs indexed by BIP152 short id.
+    uint64_t short_id_limit{ 0 };
+
+    /// Memory budget (bytes) of governed table residency (zero disables).
+    uint64_t residency_limit{ 0 };
+
+    /// Lock table heads into memory (mlock) when within residency budget.
+    bool residency_lock{ false };
+
+    /// Bytes of each body tail prefaulted along with heads (zero for none).
+    uint64_t prefault_tail{ 0 };
+
+    /// Attach to a store owned by another (writer) process, without locks.
+    bool read_only{ false };
+
     /// Path to the database directory.
     std::filesystem::path path{ "bitcoin" };
 
+    /// Directory overrides keyed by table file name (e.g. "archive_input.data"
+    /// or "archive_header.head"), otherwise path (body) or path/heads (head).
+    /// Snapshots of heads remain under path (primary/secondary/temporary).
+    std::unordered_map<std::string, std::filesystem::path> paths{};
+
     /// Archives.
     /// -----------------------------------------------------------------------
 
@@ -92,6 +123,12 @@ struct BCD_API settings
     uint64_t strong_tx_size;
     uint16_t strong_tx_rate;
 
+    uint64_t spent_size;
+    uint16_t spent_rate;
+
+    uint64_t subroot_size;
+    uint16_t subroot_rate;
+
     /// Caches.
     /// -----------------------------------------------------------------------
 
@@ -100,6 +137,7 @@ struct BCD_API settings
     uint64_t duplicate_size;
     uint16_t duplicate_rate;
 
+    /// Prevout cache (two generations of this configuration).
     uint32_t prevout_buckets;
     uint64_t prevout_size;
     uint16_t prevout_rate;
@@ -108,10 +146,14 @@ struct BCD_API settings
     uint64_t validated_bk_size;
     uint16_t validated_bk_rate;
 
+    /// Tx validation state (two generations of this configuration).
     uint32_t validated_tx_buckets;
     uint64_t validated_tx_size;
     uint16_t validated_tx_rate;
 
+    /// Heights below the top candidate retained upon rotation (zero disables).
+    uint32_t validated_tx_window;
+
     /// Optionals.
     /// -----------------------------------------------------------------------
 
@@ -126,6 +168,18 @@ struct BCD_API settings
     uint32_t filter_tx_buckets;
     uint64_t filter_tx_size;
     uint16_t filter_tx_rate;
+
+    uint32_t fee_bk_buckets;
+    uint64_t fee_bk_size;
+    uint16_t fee_bk_rate;
+
+    /// Unconfirmed tx pool (two generations of this configuration).
+    uint32_t pool_buckets;
+    uint64_t pool_size;
+    uint16_t pool_rate;
+
+    /// Body bytes of the current pool generation that cause a rotation.
+    uint64_t pool_limit;
 };
 
 } // namespace database
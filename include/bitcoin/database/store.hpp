@@ -19,7 +19,9 @@
 #ifndef LIBBITCOIN_DATABASE_STORE_HPP
 #define LIBBITCOIN_DATABASE_STORE_HPP
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 #include <bitcoin/database/define.hpp>
@@ -42,6 +44,7 @@ public:
 
     typedef std::function<void(event_t, table_t)> event_handler;
     typedef std::function<void(const code&, table_t)> error_handler;
+    typedef std::function<void(size_t, table_t)> residency_handler;
     typedef std::shared_lock<std::shared_timed_mutex> transactor;
 
     // event and table names, useful for internal logging.
@@ -60,6 +63,21 @@ public:
     /// Depth of electrum merkle tree interval caching.
     uint8_t interval_depth() const NOEXCEPT;
 
+    /// Memory budget (bytes) of the wire block/header cache.
+    size_t wire_cache_limit() const NOEXCEPT;
+
+    /// Memory budget (bytes) of the block merkle tree cache.
+    size_t merkle_cache_limit() const NOEXCEPT;
+
+    /// Count of recent unconfirmed txs indexed by BIP152 short id.
+    size_t short_id_limit() const NOEXCEPT;
+
+    /// Body bytes of the current pool generation that cause a rotation.
+    size_t pool_limit() const NOEXCEPT;
+
+    /// Heights of tx validation state retained upon rotation.
+    size_t validated_tx_window() const NOEXCEPT;
+
     /// Methods.
     /// -----------------------------------------------------------------------
 
@@ -67,13 +85,20 @@ public:
     code create(const event_handler& handler) NOEXCEPT;
 
     /// Open and load the set of tables, set locks.
+    /// Tables added since creation are created, and indexes rebuilt as needed.
     code open(const event_handler& handler) NOEXCEPT;
 
     /// Prune prunable tables (from loaded, leaves loaded).
+    /// Swaps prevout generations, the retired one is emptied upon snapshot.
+    /// Returns pending_prune if the retired generation is not yet emptied.
     code prune(const event_handler& handler) NOEXCEPT;
 
     /// Snapshot the set of tables (from loaded, leaves loaded).
-    code snapshot(const event_handler& handler, bool prune=false) NOEXCEPT;
+    code snapshot(const event_handler& handler) NOEXCEPT;
+
+    /// Prevout generations (call under transactor, see prune).
+    table::prevout& current_prevout() NOEXCEPT;
+    table::prevout& prior_prevout() NOEXCEPT;
 
     /// Restore the most recent snapshot (from closed, leaves loaded).
     code restore(const event_handler& handler) NOEXCEPT;
@@ -84,6 +109,16 @@ public:
     /// Unload and close the set of tables, clear locks.
     code close(const event_handler& handler) NOEXCEPT;
 
+    /// Follow the counts and generations last published by the writer (read
+    /// only, loaded). Lookups may miss records published since the last
+    /// refresh. The writer truncates a retired prevout generation upon
+    /// snapshot, so a follower must refresh between its prune and snapshot.
+    code refresh(const event_handler& handler) NOEXCEPT;
+
+    /// Publish table body counts and generations for read only followers
+    /// (loaded). Writes are suspended for the duration, nothing is flushed.
+    code publish(const event_handler& handler) NOEXCEPT;
+
     /// Context.
     /// -----------------------------------------------------------------------
 
@@ -94,6 +129,20 @@ public:
     bool is_dirty() const NOEXCEPT;
     void set_dirty() NOEXCEPT;
 
+    /// Current pool generation (persisted with heads, see query rotate_pool).
+    size_t pool_generation() const NOEXCEPT;
+    void set_pool_generation(size_t generation) NOEXCEPT;
+
+    /// Current validated_tx generation (persisted with heads, see query
+    /// rotate_validated_tx).
+    size_t validated_tx_generation() const NOEXCEPT;
+    void set_validated_tx_generation(size_t generation) NOEXCEPT;
+
+    /// False for a follower, as the writer may retire or reset the prior
+    /// generation of a swapped table at any time. Only the current generation
+    /// (as of the last refresh) is read by a follower.
+    bool is_prior_readable() const NOEXCEPT;
+
     /// Get first fault code or error::success.
     code get_fault() const NOEXCEPT;
 
@@ -103,6 +152,29 @@ public:
     /// Dump all error/full conditions to handler.
     void report(const error_handler& handler) const NOEXCEPT;
 
+    /// Dump resident bytes of all heads and bodies to handler.
+    void report(const residency_handler& handler) const NOEXCEPT;
+
+    /// Advise memory map access to a head or body byte range (from loaded).
+    code advise(table_t table, advice_t advice, size_t offset=zero,
+        size_t size=storage::eof) NOEXCEPT;
+
+    /// Apply the access advice policy of a sync phase (from loaded).
+    /// Initial favors sequential body writes, steady favors random reads.
+    code advise_initial() NOEXCEPT;
+    code advise_steady() NOEXCEPT;
+
+    /// Prefault all heads and prefault_tail of each body, in parallel (loaded).
+    /// Safe to run concurrently with queries (e.g. in background after open).
+    /// Handler is invoked once per prefaulted file, from distinct threads but
+    /// not concurrently.
+    code prefault(const event_handler& handler) NOEXCEPT;
+
+    /// Sample residency and enforce residency_limit in priority order: heads
+    /// (optionally locked), index bodies, recent body tails. Only the excess of
+    /// residency over budget is paged out of cold bodies, oldest first.
+    code govern() NOEXCEPT;
+
     /// Tables.
     /// -----------------------------------------------------------------------
 
@@ -120,25 +192,49 @@ public:
     table::height candidate;
     table::height confirmed;
     table::strong_tx strong_tx;
+    table::spent spent;
+    table::subroot subroot;
 
     /// Caches.
     table::duplicate duplicate;
     table::prevout prevout;
+    table::prevout prevout1;
     table::validated_bk validated_bk;
     table::validated_tx validated_tx;
+    table::validated_tx validated_tx1;
 
     /// Optionals.
     table::address address;
     table::filter_bk filter_bk;
     table::filter_tx filter_tx;
+    table::fee_bk fee_bk;
+
+    /// Unconfirmed (ephemeral) tables.
+    table::pool pool0;
+    table::pool pool1;
+
+    /// Memory.
+    /// -----------------------------------------------------------------------
+
+    /// Negative lookup filter over tx hashes (see settings.tx_bloom_limit).
+    hash_bloom tx_bloom;
 
 protected:
     using path = std::filesystem::path;
 
     code open_load(const event_handler& handler) NOEXCEPT;
+    code add_files(const event_handler& handler) NOEXCEPT;
+    void add_tables(code& ec, const event_handler& handler) NOEXCEPT;
+    void migrate(code& ec, const event_handler& handler) NOEXCEPT;
+    code rebuild(const event_handler& handler) NOEXCEPT;
+    void load_bloom(const event_handler& handler) NOEXCEPT;
+    code follow(const event_handler& handler) NOEXCEPT;
     code unload_close(const event_handler& handler) NOEXCEPT;
     code backup(const event_handler& handler, bool prune=false) NOEXCEPT;
+    code prune_prevout(const event_handler& handler) NOEXCEPT;
     code dump(const path& folder, const event_handler& handler) NOEXCEPT;
+    code load_generations(const path& folder) NOEXCEPT;
+    code save_generations(const path& folder) const NOEXCEPT;
 
     // These are thread safe.
     const settings& configuration_;
@@ -193,6 +289,14 @@ protected:
     Storage strong_tx_head_;
     Storage strong_tx_body_;
 
+    // bitmap array
+    Storage spent_head_;
+    Storage spent_body_;
+
+    // merkle mountain range array
+    Storage subroot_head_;
+    Storage subroot_body_;
+
     /// Caches.
     /// -----------------------------------------------------------------------
 
@@ -203,6 +307,8 @@ protected:
     // bloc arraymap
     Storage prevout_head_;
     Storage prevout_body_;
+    Storage prevout1_head_;
+    Storage prevout1_body_;
 
     // record hashmap
     Storage validated_bk_head_;
@@ -211,6 +317,8 @@ protected:
     // record multimap
     Storage validated_tx_head_;
     Storage validated_tx_body_;
+    Storage validated_tx1_head_;
+    Storage validated_tx1_body_;
 
     /// Optionals.
     /// -----------------------------------------------------------------------
@@ -227,6 +335,16 @@ protected:
     Storage filter_tx_head_;
     Storage filter_tx_body_;
 
+    // record arraymap
+    Storage fee_bk_head_;
+    Storage fee_bk_body_;
+
+    // slab hashmap (ephemeral)
+    Storage pool0_head_;
+    Storage pool0_body_;
+    Storage pool1_head_;
+    Storage pool1_body_;
+
     /// Locks.
     /// -----------------------------------------------------------------------
 
@@ -235,10 +353,21 @@ protected:
     interprocess_lock process_lock_;
     std::shared_timed_mutex transactor_mutex_{};
 
-    // This is thread safe.
+    // These are protected by transactor_mutex_ (written exclusively).
+    // Persisted to /heads upon close and to the dump folder upon snapshot.
+    size_t prevout_generation_{};
+    bool prevout_retired_{};
+
+    // These are thread safe.
     stopper dirty_{ true };
+    std::atomic<size_t> pool_generation_{};
+    std::atomic<size_t> validated_tx_generation_{};
 
 private:
+    // prevout generation, prevout retired, pool and validated_tx generations.
+    static constexpr size_t generations_size = sizeof(uint64_t) +
+        sizeof(uint8_t) + sizeof(uint64_t) + sizeof(uint64_t);
+
     static inline path head(const path& folder, const std::string& name) NOEXCEPT
     {
         return folder / (name + schema::ext::head);
@@ -249,6 +378,27 @@ private:
         return folder / (name + schema::ext::data);
     }
 
+    static inline path head(const settings& config,
+        const std::string& name) NOEXCEPT
+    {
+        return head(placement(config, name + schema::ext::head,
+            config.path / schema::dir::heads), name);
+    }
+
+    static inline path body(const settings& config,
+        const std::string& name) NOEXCEPT
+    {
+        return body(placement(config, name + schema::ext::data, config.path),
+            name);
+    }
+
+    static inline path placement(const settings& config,
+        const std::string& file, const path& default_folder) NOEXCEPT
+    {
+        const auto it = config.paths.find(file);
+        return it == config.paths.end() ? default_folder : it->second;
+    }
+
     static inline path lock(const path& folder, const std::string& name) NOEXCEPT
     {
         return folder / (name + schema::ext::lock);
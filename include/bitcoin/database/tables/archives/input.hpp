@@ -216,6 +216,57 @@ struct input
 
         bytewriter& sink;
     };
+
+    struct wire_script_witness
+      : public schema::input
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            // script (prefixed)
+            const auto length = source.read_size();
+            sink.write_variable(length);
+            sink.write_bytes(source.read_bytes(length));
+
+            // witness (count)
+            const auto count = source.read_size();
+            witness_sink.write_variable(count);
+
+            // witness (prefixed)
+            for (size_t element{}; element < count; ++element)
+            {
+                const auto size = source.read_size();
+                witness_sink.write_variable(size);
+                witness_sink.write_bytes(source.read_bytes(size));
+            }
+
+            return source;
+        }
+
+        bytewriter& sink;
+        bytewriter& witness_sink;
+    };
+
+    struct wire_spans
+      : public schema::input
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            // script (prefixed, stored in wire encoding)
+            source.skip_bytes(source.read_size());
+            script = source.get_read_position();
+
+            // witness (counted and prefixed, stored in wire encoding)
+            const auto count = source.read_size();
+            for (size_t element{}; element < count; ++element)
+                source.skip_bytes(source.read_size());
+
+            witness = source.get_read_position() - script;
+            return source;
+        }
+
+        size_t script{};
+        size_t witness{};
+    };
 };
 
 BC_POP_WARNING()
@@ -252,6 +252,29 @@ struct output
 
         bytewriter& sink;
     };
+
+    struct wire_spans
+      : public schema::output
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            // skip: parent_fk
+            source.skip_bytes(tx::size);
+
+            // value (stored as variable, wire is fixed width)
+            value = source.read_variable();
+
+            // script (prefixed, stored in wire encoding)
+            start = source.get_read_position();
+            source.skip_bytes(source.read_size());
+            script = source.get_read_position() - start;
+            return source;
+        }
+
+        uint64_t value{};
+        size_t start{};
+        size_t script{};
+    };
 };
 
 BC_POP_WARNING()
@@ -34,7 +34,13 @@ enum class event_t
 
     create_table,
     verify_table,
+    migrate_table,
+    rebuild_table,
     close_table,
+    load_bloom,
+    prefault_file,
+    follow_table,
+    publish_table,
 
     wait_lock,
     flush_body,
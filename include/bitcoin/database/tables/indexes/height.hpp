@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_DATABASE_TABLES_INDEXES_HEIGHT_HPP
 #define LIBBITCOIN_DATABASE_TABLES_INDEXES_HEIGHT_HPP
 
+#include <algorithm>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/primitives/primitives.hpp>
 #include <bitcoin/database/tables/schema.hpp>
@@ -58,6 +59,30 @@ struct height
 
         header::integer header_fk{};
     };
+
+    struct put_refs
+      : public schema::height
+    {
+        inline link count() const NOEXCEPT
+        {
+            return system::possible_narrow_cast<link::integer>(
+                header_fks_.size());
+        }
+
+        inline bool to_data(flipper& sink) const NOEXCEPT
+        {
+            std::for_each(header_fks_.cbegin(), header_fks_.cend(),
+                [&](const auto& fk) NOEXCEPT
+                {
+                    sink.write_little_endian<header::integer, header::size>(fk);
+                });
+
+            BC_ASSERT(!sink || sink.get_write_position() == count() * minrow);
+            return sink;
+        }
+
+        const std::vector<header::integer>& header_fks_;
+    };
 };
 
 } // namespace table
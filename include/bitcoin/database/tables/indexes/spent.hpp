@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_INDEXES_SPENT_HPP
+#define LIBBITCOIN_DATABASE_TABLES_INDEXES_SPENT_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// spent is a bitmap of confirmed-spent state, one bit per outs record.
+/// Outs records are dense output ordinals (output links are sparse offsets).
+/// The head cell marks the bitmap complete, covering all confirmed blocks.
+struct spent
+  : public no_map<schema::spent>
+{
+    using outs = schema::outs::link;
+
+    spent(storage& header, storage& body) NOEXCEPT
+      : no_map<schema::spent>(header, body, one)
+    {
+    }
+
+    /// Bitmap covers all confirmed blocks (unset upon create, see rebuild).
+    inline bool is_complete() const NOEXCEPT
+    {
+        return at(zero) == complete;
+    }
+
+    /// Set or clear the complete marker.
+    inline bool set_complete(bool value) NOEXCEPT
+    {
+        return push(value ? complete : link{}, zero);
+    }
+
+    /// Byte (record) containing the bit of the outs record.
+    static constexpr link::integer to_byte(outs::integer outs_fk) NOEXCEPT
+    {
+        return outs_fk / system::byte_bits;
+    }
+
+    /// Mask of the bit of the outs record within its byte (record).
+    static constexpr uint8_t to_mask(outs::integer outs_fk) NOEXCEPT
+    {
+        return system::bit_right<uint8_t>(outs_fk % system::byte_bits);
+    }
+
+    struct record
+      : public schema::spent
+    {
+        inline bool is_spent(outs::integer outs_fk) const NOEXCEPT
+        {
+            return system::get_right(bits, outs_fk % system::byte_bits);
+        }
+
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            bits = source.read_byte();
+            BC_ASSERT(!source || source.get_read_position() == minrow);
+            return source;
+        }
+
+        inline bool to_data(flipper& sink) const NOEXCEPT
+        {
+            sink.write_byte(bits);
+            BC_ASSERT(!sink || sink.get_write_position() == minrow);
+            return sink;
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return bits == other.bits;
+        }
+
+        uint8_t bits{};
+    };
+
+private:
+    static constexpr link complete{ 0 };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_INDEXES_SUBROOT_HPP
+#define LIBBITCOIN_DATABASE_TABLES_INDEXES_SUBROOT_HPP
+
+#include <bit>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// subroot is a merkle mountain range over confirmed interval roots.
+/// Node (level, index) covers 2^level intervals from index * 2^level, and
+/// nodes are stored in postorder, so the range is truncated by interval.
+struct subroot
+  : public no_map<schema::subroot>
+{
+    using no_map<schema::subroot>::nomap;
+
+    /// Number of nodes in a range of the given number of intervals (leaves).
+    static constexpr size_t to_nodes(size_t leaves) NOEXCEPT
+    {
+        using namespace system;
+        return (leaves + leaves) - possible_sign_cast<size_t>(
+            std::popcount(leaves));
+    }
+
+    /// Position of node (level, index), which covers leaves up to its end.
+    static constexpr link::integer to_node(size_t level,
+        size_t index) NOEXCEPT
+    {
+        using namespace system;
+        const auto width = power2(level);
+        return possible_narrow_cast<link::integer>(
+            to_nodes(index * width) + (width + width) - two);
+    }
+
+    struct record
+      : public schema::subroot
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            hash = source.read_hash();
+            BC_ASSERT(!source || source.get_read_position() == minrow);
+            return source;
+        }
+
+        inline bool to_data(flipper& sink) const NOEXCEPT
+        {
+            sink.write_bytes(hash);
+            BC_ASSERT(!sink || sink.get_write_position() == minrow);
+            return sink;
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return hash == other.hash;
+        }
+
+        hash_digest hash{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -53,14 +53,18 @@ namespace indexes
     constexpr auto candidate = "candidate";
     constexpr auto confirmed = "confirmed";
     constexpr auto strong_tx = "strong_tx";
+    constexpr auto spent = "spent";
+    constexpr auto subroot = "subroot";
 }
 
 namespace caches
 {
     constexpr auto duplicate = "duplicate";
     constexpr auto prevout = "prevout";
+    constexpr auto prevout1 = "prevout1";
     constexpr auto validated_bk = "validated_bk";
     constexpr auto validated_tx = "validated_tx";
+    constexpr auto validated_tx1 = "validated_tx1";
 }
 
 namespace optionals
@@ -68,6 +72,14 @@ namespace optionals
     constexpr auto address = "address";
     constexpr auto filter_bk = "filter_bk";
     constexpr auto filter_tx = "filter_tx";
+    constexpr auto fee_bk = "fee_bk";
+    constexpr auto pool0 = "pool0";
+    constexpr auto pool1 = "pool1";
+}
+
+namespace marker
+{
+    constexpr auto generations = "generations";
 }
 
 namespace locks
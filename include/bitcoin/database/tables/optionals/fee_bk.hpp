@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_OPTIONALS_FEE_BK_HPP
+#define LIBBITCOIN_DATABASE_TABLES_OPTIONALS_FEE_BK_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+#include <bitcoin/database/types/fee_rate.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// fee_bk is a record arraymap of fee rate histograms indexed by block link.
+struct fee_bk
+  : public array_map<schema::fee_bk>
+{
+    using bytes = linkage<schema::size>;
+    using txs = linkage<schema::count_>;
+    using array_map<schema::fee_bk>::arraymap;
+    static_assert(schema::fee_bk::bins == fee_histogram::bins);
+
+    struct record
+      : public schema::fee_bk
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            histogram.fee = source.read_8_bytes_little_endian();
+            histogram.bytes = source.read_little_endian<bytes::integer, bytes::size>();
+            histogram.count = source.read_little_endian<txs::integer, txs::size>();
+            for (auto& size: histogram.sizes)
+                size = source.read_little_endian<bytes::integer, bytes::size>();
+
+            BC_ASSERT(!source || source.get_read_position() == count() * minrow);
+            return source;
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            using namespace system;
+            sink.write_8_bytes_little_endian(histogram.fee);
+            sink.write_little_endian<bytes::integer, bytes::size>(
+                possible_narrow_cast<bytes::integer>(histogram.bytes));
+            sink.write_little_endian<txs::integer, txs::size>(
+                possible_narrow_cast<txs::integer>(histogram.count));
+            for (const auto size: histogram.sizes)
+                sink.write_little_endian<bytes::integer, bytes::size>(
+                    possible_narrow_cast<bytes::integer>(size));
+
+            BC_ASSERT(!sink || sink.get_write_position() == count() * minrow);
+            return sink;
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return histogram.fee == other.histogram.fee
+                && histogram.bytes == other.histogram.bytes
+                && histogram.count == other.histogram.count
+                && histogram.sizes == other.histogram.sizes;
+        }
+
+        fee_histogram histogram{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_OPTIONALS_POOL_HPP
+#define LIBBITCOIN_DATABASE_TABLES_OPTIONALS_POOL_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// pool is a slab hashmap of wire encoded unconfirmed txs (one generation).
+struct pool
+  : public hash_map<schema::pool>
+{
+    using hash_map<schema::pool>::hashmap;
+
+    struct get_tx
+      : public schema::pool
+    {
+        inline link count() const NOEXCEPT
+        {
+            BC_ASSERT(false);
+            return {};
+        }
+
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            using namespace system;
+            tx = to_shared<chain::transaction>(source, true);
+            return source;
+        }
+
+        system::chain::transaction::cptr tx{};
+    };
+
+    struct put_ref
+      : public schema::pool
+    {
+        inline link count() const NOEXCEPT
+        {
+            using namespace system;
+            return possible_narrow_cast<link::integer>(pk + sk +
+                tx.serialized_size(true));
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            tx.to_data(sink, true);
+            BC_ASSERT(!sink || sink.get_write_position() == count());
+            return sink;
+        }
+
+        const system::chain::transaction& tx{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -50,6 +50,7 @@ constexpr size_t tx = 4;        // ->tx record.
 constexpr size_t block = 3;     // ->header record.
 constexpr size_t tx_slab = 5;   // ->validated_tx record.
 constexpr size_t filter_ = 5;   // ->filter record.
+constexpr size_t pool_ = 5;     // ->pool slab.
 constexpr size_t doubles_ = 4;  // doubles bucket (no actual keys).
 
 /// Archive tables.
@@ -256,6 +257,34 @@ struct strong_tx
     static_assert(cell == 4u);
 };
 
+// bitmap array (one bit per outs record)
+struct spent
+{
+    static constexpr size_t pk = schema::outs_;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t minsize = one;
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = minsize;
+    static constexpr link count() NOEXCEPT { return 1; }
+    static_assert(minsize == 1u);
+    static_assert(minrow == 1u);
+    static_assert(link::size == 4u);
+};
+
+// merkle mountain range array (interval subroots and parents, postorder)
+struct subroot
+{
+    static constexpr size_t pk = schema::block;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t minsize = schema::hash;
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = minsize;
+    static constexpr link count() NOEXCEPT { return 1; }
+    static_assert(minsize == 32u);
+    static_assert(minrow == 32u);
+    static_assert(link::size == 3u);
+};
+
 /// Cache tables.
 /// ---------------------------------------------------------------------------
 
@@ -352,12 +381,13 @@ struct address
         schema::output::pk;
     static constexpr size_t minrow = pk + sk + minsize;
     static constexpr size_t size = minsize;
-    static constexpr size_t cell = link::size;
+    static constexpr size_t cell = sizeof(uint64_t);
+    static constexpr size_t legacy_cell = link::size;
     static constexpr link count() NOEXCEPT { return 1; }
     static_assert(minsize == 5u);
     static_assert(minrow == 41u);
     static_assert(link::size == 4u);
-    static_assert(cell == 4u);
+    static_assert(cell == 8u);
 };
 
 // record arraymap
@@ -393,6 +423,50 @@ struct filter_tx
     static_assert(link::size == 5u);
 };
 
+// record arraymap
+struct fee_bk
+{
+    static constexpr size_t align = false;
+    static constexpr size_t pk = schema::header::pk;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t bins = 20;
+    static constexpr size_t minsize =
+        sizeof(uint64_t) +      // fee
+        schema::size +          // virtual size
+        schema::count_ +        // tx count (excluding coinbase)
+        bins * schema::size;    // virtual size by fee rate bin
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = minsize;
+    static constexpr link count() NOEXCEPT { return 1; }
+    static_assert(minsize == 73u);
+    static_assert(minrow == 73u);
+    static_assert(link::size == 3u);
+};
+
+/// Pool tables.
+/// ---------------------------------------------------------------------------
+
+// slab hashmap, wire encoded (witness) unconfirmed tx by tx hash.
+struct pool
+{
+    static constexpr size_t sk = schema::hash;
+    static constexpr size_t pk = schema::pool_;
+    using link = linkage<pk, to_bits(pk)>;
+    using key = system::data_array<sk>;
+    static constexpr size_t minsize =
+        sizeof(uint32_t) +      // version
+        one +                   // inputs count (variable)
+        one +                   // outputs count (variable)
+        sizeof(uint32_t);       // locktime
+    static constexpr size_t minrow = pk + sk + minsize;
+    static constexpr size_t size = max_size_t;
+    static constexpr size_t cell = link::size;
+    static inline link count() NOEXCEPT;
+    static_assert(minsize == 10u);
+    static_assert(minrow == 47u);
+    static_assert(link::size == 5u);
+};
+
 } // namespace schema
 } // namespace database
 } // namespace libbitcoin
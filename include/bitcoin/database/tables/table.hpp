@@ -67,6 +67,12 @@ enum class table_t
     strong_tx_table,
     strong_tx_head,
     strong_tx_body,
+    spent_table,
+    spent_head,
+    spent_body,
+    subroot_table,
+    subroot_head,
+    subroot_body,
 
     /// Caches.
     duplicate_table,
@@ -75,12 +81,18 @@ enum class table_t
     prevout_table,
     prevout_head,
     prevout_body,
+    prevout1_table,
+    prevout1_head,
+    prevout1_body,
     validated_bk_table,
     validated_bk_head,
     validated_bk_body,
     validated_tx_table,
     validated_tx_head,
     validated_tx_body,
+    validated_tx1_table,
+    validated_tx1_head,
+    validated_tx1_body,
 
     /// Optionals.
     address_table,
@@ -91,7 +103,17 @@ enum class table_t
     filter_bk_body,
     filter_tx_table,
     filter_tx_head,
-    filter_tx_body
+    filter_tx_body,
+    fee_bk_table,
+    fee_bk_head,
+    fee_bk_body,
+
+    pool0_table,
+    pool0_head,
+    pool0_body,
+    pool1_table,
+    pool1_head,
+    pool1_body
 };
 
 } // namespace database
@@ -34,11 +34,15 @@
 #include <bitcoin/database/tables/caches/validated_tx.hpp>
 
 #include <bitcoin/database/tables/indexes/height.hpp>
+#include <bitcoin/database/tables/indexes/spent.hpp>
 #include <bitcoin/database/tables/indexes/strong_tx.hpp>
+#include <bitcoin/database/tables/indexes/subroot.hpp>
 
 #include <bitcoin/database/tables/optionals/address.hpp>
+#include <bitcoin/database/tables/optionals/fee_bk.hpp>
 #include <bitcoin/database/tables/optionals/filter_bk.hpp>
 #include <bitcoin/database/tables/optionals/filter_tx.hpp>
+#include <bitcoin/database/tables/optionals/pool.hpp>
 
 #include <bitcoin/database/tables/association.hpp>
 #include <bitcoin/database/tables/associations.hpp>
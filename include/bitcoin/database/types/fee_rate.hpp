@@ -19,6 +19,9 @@
 #ifndef LIBBITCOIN_DATABASE_TYPES_FEE_RATE_HPP
 #define LIBBITCOIN_DATABASE_TYPES_FEE_RATE_HPP
 
+#include <algorithm>
+#include <array>
+#include <iterator>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -33,6 +36,42 @@ struct fee_rate
 using fee_rates = std::vector<fee_rate>;
 using fee_rate_sets = std::vector<fee_rates>;
 
+/// Fee rate histogram of the non-coinbase txs of a block. Each bin totals the
+/// virtual size of txs with fee rate (satoshi per virtual byte) at or above
+/// its lower bound and below that of the next bin.
+struct fee_histogram
+{
+    static constexpr size_t bins = 20;
+    static constexpr std::array<uint64_t, bins> bounds
+    {
+        0, 1, 2, 3, 4, 5, 6, 8, 10, 12, 15, 20, 25, 30, 40, 50, 75, 100, 200,
+        500
+    };
+
+    static constexpr size_t to_bin(uint64_t fee, size_t bytes) NOEXCEPT
+    {
+        const auto rate = is_zero(bytes) ? zero : fee / bytes;
+        const auto it = std::upper_bound(bounds.begin(), bounds.end(), rate);
+        return sub1(system::possible_narrow_and_sign_cast<size_t>(
+            std::distance(bounds.begin(), it)));
+    }
+
+    constexpr void add(uint64_t tx_fee, size_t tx_bytes) NOEXCEPT
+    {
+        fee += tx_fee;
+        bytes += tx_bytes;
+        sizes.at(to_bin(tx_fee, tx_bytes)) += tx_bytes;
+        ++count;
+    }
+
+    uint64_t fee{};
+    size_t bytes{};
+    size_t count{};
+    std::array<size_t, bins> sizes{};
+};
+
+using fee_histograms = std::vector<fee_histogram>;
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_HASH_BLOOM_HPP
+#define LIBBITCOIN_DATABASE_TYPES_HASH_BLOOM_HPP
+
+#include <atomic>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Memory resident blocked bloom filter over hash keys, used to bypass table
+/// search for keys that are not stored. Each key sets bits in a single cache
+/// line sized block, so a test costs at most one cache miss. Keys are assumed
+/// to be uniformly distributed (e.g. sha256), so bits are taken directly from
+/// the key. Insertion is lock free and may run concurrent with tests. Until
+/// loaded (or when disabled) all keys test as possibly present.
+class BCD_API hash_bloom
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(hash_bloom);
+
+    /// Construct with a memory budget in bytes, zero disables.
+    hash_bloom(size_t limit) NOEXCEPT;
+
+    /// True if the budget is at least one block.
+    bool enabled() const NOEXCEPT;
+
+    /// True if the filter has been populated from the table.
+    bool loaded() const NOEXCEPT;
+
+    /// False implies key is not stored (when enabled and loaded).
+    bool contains(const hash_digest& key) const NOEXCEPT;
+
+    /// Add key to the filter (thread safe).
+    void insert(const hash_digest& key) NOEXCEPT;
+
+    /// Mark filter as populated, enabling negative results.
+    void load() NOEXCEPT;
+
+    /// Clear all keys and mark filter as unpopulated.
+    void unload() NOEXCEPT;
+
+private:
+    using word = std::atomic<uint64_t>;
+    static constexpr size_t word_bits = to_bits(sizeof(uint64_t));
+    static constexpr size_t block_words = 8;
+    static constexpr size_t block_bytes = block_words * sizeof(uint64_t);
+    static constexpr size_t block_bits = to_bits(block_bytes);
+    static constexpr size_t key_bits = 8;
+
+    size_t to_block(const hash_digest& key) const NOEXCEPT;
+    static size_t to_bit(const hash_digest& key, size_t index) NOEXCEPT;
+
+    // These are thread safe.
+    const size_t blocks_;
+    std::vector<word> words_;
+    std::atomic_bool loaded_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
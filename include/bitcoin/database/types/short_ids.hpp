@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_SHORT_IDS_HPP
+#define LIBBITCOIN_DATABASE_TYPES_SHORT_IDS_HPP
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// BIP152 short transaction ids. A bounded ring of recently archived or pooled
+/// unconfirmed tx references (with witness hashes), and a small cache of short
+/// id maps built over the ring, one per SipHash key. References are links of
+/// the tx table, or flagged links of a pool generation (see query). A zero
+/// capacity disables the ring. A cached map is retained
+/// across pushes and extended by the entries pushed since it was built, so it
+/// is replaced only when the key changes (per compact block).
+class BCD_API short_ids
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(short_ids);
+
+    /// Short ids are the low six bytes of SipHash-2-4 of the witness hash.
+    static constexpr size_t id_bytes = 6;
+
+    struct key
+    {
+        uint64_t k0;
+        uint64_t k1;
+
+        constexpr bool operator==(const key& other) const NOEXCEPT = default;
+    };
+
+    struct entry
+    {
+        uint64_t link;
+        hash_digest hash;
+    };
+
+    using entries = std::vector<entry>;
+    using id = std::pair<uint64_t, uint64_t>;
+
+    /// Sorted (short id, tx reference) pairs.
+    using map = std::vector<id>;
+    using map_cptr = std::shared_ptr<const map>;
+
+    /// SipHash key of a compact block, from its header (wire) and nonce.
+    static key to_key(const data_slice& header, uint64_t nonce) NOEXCEPT;
+
+    /// Short id of the witness hash (txid for non-witness txs).
+    static uint64_t to_id(const key& key, const hash_digest& hash) NOEXCEPT;
+
+    /// SipHash-2-4 of the message.
+    static uint64_t siphash(const key& key,
+        const data_slice& message) NOEXCEPT;
+
+    /// All links of the short id in the map (more than one is a collision).
+    static std::vector<uint64_t> find(const map& map, uint64_t id) NOEXCEPT;
+
+    /// Construct with capacity in txs, zero disables.
+    short_ids(size_t capacity) NOEXCEPT;
+
+    /// True if capacity is nonzero.
+    bool enabled() const NOEXCEPT;
+
+    /// Capacity of the ring in txs.
+    size_t capacity() const NOEXCEPT;
+
+    /// Record an archived or pooled unconfirmed tx, overwriting the oldest
+    /// when full.
+    void push(uint64_t link, const hash_digest& hash) NOEXCEPT;
+
+    /// Copy ring (unordered), returns the push sequence of the copy.
+    size_t snapshot(entries& out) const NOEXCEPT;
+
+    /// Copy entries pushed after sequence and set sequence to current, false
+    /// if any such entry has since been overwritten.
+    bool since(entries& out, size_t& sequence) const NOEXCEPT;
+
+    /// Map of key if cached (with the sequence it reflects), or nullptr.
+    map_cptr get(const key& key, size_t& sequence) const NOEXCEPT;
+
+    /// Cache map of key, built from the snapshot at sequence.
+    void put(const key& key, size_t sequence, const map_cptr& map) NOEXCEPT;
+
+    /// Empty the ring and cache.
+    void clear() NOEXCEPT;
+
+private:
+    static constexpr size_t cache_count = 4;
+
+    struct cached
+    {
+        key value;
+        size_t sequence;
+        map_cptr map;
+    };
+
+    // These are protected by mutex.
+    const size_t capacity_;
+    mutable std::mutex mutex_{};
+    entries ring_{};
+    size_t sequence_{};
+    std::array<cached, cache_count> cache_{};
+    size_t next_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -42,6 +42,8 @@ using point_link = table::point::link;
 using tx_link = table::transaction::link;
 using filter_link = table::filter_tx::link;
 using strong_link = table::strong_tx::link;
+using spent_link = table::spent::link;
+using subroot_link = table::subroot::link;
 using address_link = table::address::link;
 
 /// Multiples.
@@ -49,6 +51,7 @@ using header_links = std::vector<header_link::integer>;
 using tx_links = std::vector<tx_link::integer>;
 using input_links = std::vector<input_link::integer>;
 using output_links = std::vector<output_link::integer>;
+using outs_links = std::vector<outs_link::integer>;
 using point_links = std::vector<point_link::integer>;
 using point_key = table::point::key;
 
@@ -20,11 +20,16 @@
 #define LIBBITCOIN_DATABASE_TYPES_TYPES_HPP
 
 #include <bitcoin/database/types/fee_rate.hpp>
+#include <bitcoin/database/types/hash_bloom.hpp>
+#include <bitcoin/database/types/header_entry.hpp>
 #include <bitcoin/database/types/header_state.hpp>
 #include <bitcoin/database/types/history.hpp>
 #include <bitcoin/database/types/position.hpp>
+#include <bitcoin/database/types/short_ids.hpp>
 #include <bitcoin/database/types/span.hpp>
 #include <bitcoin/database/types/type.hpp>
 #include <bitcoin/database/types/unspent.hpp>
+#include <bitcoin/database/types/wire_cache.hpp>
+#include <bitcoin/database/types/wire_segments.hpp>
 
 #endif
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_WIRE_CACHE_HPP
+#define LIBBITCOIN_DATABASE_TYPES_WIRE_CACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Memory bounded LRU cache of wire encodings (blocks and headers) and block
+/// merkle trees, keyed by header link. Entries are sharded by link, each shard
+/// with its own lock and an equal share of the byte budget. Each entry is
+/// charged its payload plus a fixed overhead, so the budget bounds memory use
+/// (significant for small header entries). A zero budget disables the cache.
+class BCD_API wire_cache
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(wire_cache);
+
+    using chunk_cptr = std::shared_ptr<const data_chunk>;
+
+    enum class kind : uint8_t
+    {
+        header,
+        block,
+        witness_block,
+        merkle_tree
+    };
+
+    struct metrics
+    {
+        size_t hits;
+        size_t misses;
+        size_t entries;
+        size_t bytes;
+    };
+
+    wire_cache(size_t capacity) NOEXCEPT;
+
+    /// Approximate heap bytes of an entry beyond its payload: list and map
+    /// nodes (with bucket), shared control block and vector, and an allocator
+    /// header for each of the four allocations.
+    static constexpr size_t overhead() NOEXCEPT
+    {
+        constexpr auto pointer = sizeof(void*);
+        return (sizeof(entry) + two * pointer) +
+            (sizeof(key) + sizeof(entries::iterator) + two * pointer) +
+            (sizeof(data_chunk) + two * pointer) + (4 * two * pointer);
+    }
+
+    /// True if the budget is nonzero.
+    bool enabled() const NOEXCEPT;
+
+    /// Get cached encoding (and promote), nullptr if not cached.
+    chunk_cptr get(uint32_t link, kind type) const NOEXCEPT;
+
+    /// Cache encoding, evicting least recently used as required. An encoding
+    /// that with overhead exceeds the shard budget is not cached.
+    void put(uint32_t link, kind type, const chunk_cptr& data) NOEXCEPT;
+
+    /// Remove all encodings of the link (e.g. on reorganization).
+    void erase(uint32_t link) NOEXCEPT;
+
+    /// Remove all encodings, metrics are retained.
+    void clear() NOEXCEPT;
+
+    /// Hit/miss counts and current occupancy (bytes include overhead).
+    metrics get_metrics() const NOEXCEPT;
+
+private:
+    static constexpr size_t shard_count = 16;
+    using key = uint64_t;
+    using entry = std::pair<key, chunk_cptr>;
+    using entries = std::list<entry>;
+
+    struct shard
+    {
+        std::mutex mutex{};
+        entries lru{};
+        std::unordered_map<key, entries::iterator> map{};
+        size_t bytes{};
+    };
+
+    static constexpr key to_key(uint32_t link, kind type) NOEXCEPT
+    {
+        return (key{ link } << byte_bits) | static_cast<uint8_t>(type);
+    }
+
+    shard& to_shard(uint32_t link) const NOEXCEPT;
+    static void remove(shard& shard, key value) NOEXCEPT;
+
+    // These are thread safe.
+    const size_t limit_;
+    mutable std::array<shard, shard_count> shards_{};
+    mutable std::atomic<size_t> hits_{};
+    mutable std::atomic<size_t> misses_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_WIRE_SEGMENTS_HPP
+#define LIBBITCOIN_DATABASE_TYPES_WIRE_SEGMENTS_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/interfaces/memory.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// iovec-style reference to contiguous wire bytes.
+struct wire_segment
+{
+    const uint8_t* data;
+    size_t size;
+};
+
+using wire_segment_list = std::vector<wire_segment>;
+
+/// Wire encoding as a sequence of segments (e.g. for writev). Generated bytes
+/// (header, varints, points, values) are held in scratch, while script and
+/// witness segments point directly into mapped store memory. Mapped segments
+/// are valid only while guards are retained, and guards preclude remap of
+/// their tables (writer stall), so release as soon as segments are written.
+struct BCD_API wire_segments
+{
+    /// Segments point into scratch, so a copy would reference the original's
+    /// buffer. Move retains the scratch buffer (and so segment addresses).
+    wire_segments() = default;
+    wire_segments(wire_segments&&) = default;
+    wire_segments& operator=(wire_segments&&) = default;
+    wire_segments(const wire_segments&) = delete;
+    wire_segments& operator=(const wire_segments&) = delete;
+
+    /// Total wire size (sum of segment sizes).
+    size_t size() const NOEXCEPT;
+
+    /// Copy of the wire encoding (for non-scatter-gather consumers).
+    data_chunk to_chunk() const NOEXCEPT;
+
+    /// Release segments, scratch and guards.
+    void reset() NOEXCEPT;
+
+    wire_segment_list segments{};
+    data_chunk scratch{};
+    std::vector<memory_ptr> guards{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
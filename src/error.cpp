@@ -58,6 +58,7 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { mremap_failure, "mremap failure" },
     { munmap_failure, "munmap failure" },
     { madvise_failure, "madvise failure" },
+    { mlock_failure, "mlock failure" },
     { sysconf_failure, "sysconf failure" },
     { ftruncate_failure, "ftruncate failure" },
     { fsync_failure, "fsync failure" },
@@ -79,6 +80,8 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { not_coalesced, "not coalesced" },
     { missing_snapshot, "missing snapshot" },
     { unloaded_file, "file not loaded" },
+    { read_only_store, "store is read only" },
+    { pending_prune, "prune pending snapshot" },
 
     // tables
     { create_table, "failed to create table" },
@@ -87,6 +90,9 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { backup_table, "failed to backup table" },
     { restore_table, "failed to restore table" },
     { verify_table, "failed to verify table" },
+    { migrate_table, "failed to migrate table" },
+    { follow_table, "failed to follow table" },
+    { publish_table, "failed to publish table" },
 
     // states
     { tx_connected, "transaction connected" },
@@ -171,6 +171,44 @@ code create_file_ex(const path& to, const uint8_t* data, size_t size) NOEXCEPT
     }
 }
 
+bool read_file(uint8_t* data, size_t size, const path& from) NOEXCEPT
+{
+    return !read_file_ex(data, size, from);
+}
+
+code read_file_ex(uint8_t* data, size_t size, const path& from) NOEXCEPT
+{
+    // Binary mode on Windows ensures that \r\n not replaced with \n.
+    try
+    {
+        // Throws.
+        ifstream file(from, std::ios_base::binary);
+
+        // noexcept.
+        if (!file.good())
+            return system::error::errorno_t::not_a_stream;
+
+        // Allow throw.
+        file.exceptions(std::ifstream::failbit);
+
+        // May throw (failbit upon short read).
+        file.read(pointer_cast<char>(data), size);
+
+        // Sets failbit (but not noexcept).
+        file.close();
+
+        // noexcept.
+        return file.good() ?
+            system::error::errorno_t::no_error :
+            system::error::errorno_t::not_a_stream;
+    }
+    catch (const std::ios_base::failure& e)
+    {
+        // Prefer throw, since we get a platform code.
+        return e.code();
+    }
+}
+
 // directory|file
 bool remove(const path& name) NOEXCEPT
 {
@@ -248,7 +286,8 @@ code copy_directory_ex(const path& from, const path& to) NOEXCEPT
     #define MSC_OR_NOAPPLE(parameter)
 #endif
 
-int open(const path& filename, bool MSC_OR_NOAPPLE(random)) NOEXCEPT
+int open(const path& filename, bool MSC_OR_NOAPPLE(random),
+    bool write) NOEXCEPT
 {
     const auto path = system::extended_path(filename);
     int file_descriptor{};
@@ -258,10 +297,12 @@ int open(const path& filename, bool MSC_OR_NOAPPLE(random)) NOEXCEPT
     // sets file_descriptor = -1 and errno on error.
     const auto access = (random ? _O_RANDOM : _O_SEQUENTIAL);
     ::_wsopen_s(&file_descriptor, path.c_str(),
-        O_RDWR | _O_BINARY | access, _SH_DENYWR, _S_IREAD | _S_IWRITE);
+        (write ? O_RDWR : _O_RDONLY) | _O_BINARY | access,
+        (write ? _SH_DENYWR : _SH_DENYNO), _S_IREAD | _S_IWRITE);
 #else
     // open sets errno on failure.
-    file_descriptor = ::open(path.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+    file_descriptor = ::open(path.c_str(), write ? O_RDWR : O_RDONLY,
+        S_IRUSR | S_IWUSR);
 
 #if !defined(HAVE_APPLE)
     if (file_descriptor != -1)
@@ -275,7 +316,7 @@ int open(const path& filename, bool MSC_OR_NOAPPLE(random)) NOEXCEPT
             file_descriptor = -1;
             errno = result;
         }
-        else
+        else if (write)
         {
             // _SH_DENYWR equivalent.
             const struct flock lock{ F_WRLCK, SEEK_SET, 0, 0 };
@@ -294,10 +335,11 @@ int open(const path& filename, bool MSC_OR_NOAPPLE(random)) NOEXCEPT
     return file_descriptor;
 }
 
-code open_ex(int& file_descriptor, const path& filename, bool random) NOEXCEPT
+code open_ex(int& file_descriptor, const path& filename, bool random,
+    bool write) NOEXCEPT
 {
     system::error::clear_errno();
-    file_descriptor = open(filename, random);
+    file_descriptor = open(filename, random, write);
     return system::error::get_errno();
 }
 
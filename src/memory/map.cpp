@@ -27,11 +27,13 @@
     #include <unistd.h>
 #endif
 #include <algorithm>
+#include <cerrno>
 #include <chrono>
 #include <fcntl.h>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/file/file.hpp>
 
@@ -47,11 +49,13 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 using namespace system;
 
 map::map(const path& filename, size_t minimum, size_t expansion,
-    bool random) NOEXCEPT
+    bool random, bool read_only) NOEXCEPT
   : filename_(filename),
     minimum_(minimum),
     expansion_(expansion),
-    random_(random)
+    random_(random),
+    read_only_(read_only),
+    pattern_(random ? advice_t::random : advice_t::sequential)
 {
 }
 
@@ -77,7 +81,7 @@ code map::open() NOEXCEPT
         return error::open_open;
 
     // Windows doesn't use madvise, instead infers map access from file open.
-    if (const auto ec = file::open_ex(opened_, filename_, random_))
+    if (const auto ec = file::open_ex(opened_, filename_, random_, !read_only_))
         return ec;
 
     return file::size_ex(logical_, opened_);
@@ -172,6 +176,10 @@ code map::flush() NOEXCEPT
     if (!loaded_)
         return error::flush_unloaded;
 
+    // Nothing is written through a read-only map.
+    if (read_only_)
+        return error::success;
+
     // Reads fields and the memory map.
     return flush_() ? error::success : error::flush_failure;
 }
@@ -244,6 +252,29 @@ bool map::expand(size_t size) NOEXCEPT
     if (fault_ || !loaded_)
         return false;
 
+    // Follow the writer, remapping to its current file size. The file shrinks
+    // when the writer truncates a body (e.g. prune), and pages beyond its end
+    // cannot be read (SIGBUS), so the map is also remapped upon shrink.
+    if (read_only_)
+    {
+        size_t file_size{};
+        if (file::size_ex(file_size, opened_))
+            return false;
+
+        if (file_size != capacity_)
+        {
+            std::unique_lock remap_lock(remap_mutex_);
+            if (!unmap_() || !map_())
+                return false;
+        }
+
+        if (size > capacity_)
+            return false;
+
+        logical_ = size;
+        return true;
+    }
+
     if (size <= logical_)
         return true;
 
@@ -263,7 +294,7 @@ bool map::reserve(size_t chunk) NOEXCEPT
 {
     std::unique_lock field_lock(field_mutex_);
 
-    if (fault_ || !loaded_ || is_add_overflow(logical_, chunk))
+    if (fault_ || !loaded_ || read_only_ || is_add_overflow(logical_, chunk))
         return false;
 
     const auto end = logical_ + chunk;
@@ -286,7 +317,7 @@ size_t map::allocate(size_t chunk) NOEXCEPT
 {
     std::unique_lock field_lock(field_mutex_);
 
-    if (fault_ || !loaded_ || is_add_overflow(logical_, chunk))
+    if (fault_ || !loaded_ || read_only_ || is_add_overflow(logical_, chunk))
         return storage::eof;
 
     auto end = logical_ + chunk;
@@ -311,7 +342,7 @@ memory_ptr map::set(size_t offset, size_t size, uint8_t backfill) NOEXCEPT
     {
         std::unique_lock field_lock(field_mutex_);
 
-        if (fault_ || !loaded_ || is_add_overflow(offset, size))
+        if (fault_ || !loaded_ || read_only_ || is_add_overflow(offset, size))
             return {};
 
         const auto end = std::max(logical_, offset + size);
@@ -345,18 +376,25 @@ memory_ptr map::get(size_t offset) const NOEXCEPT
     // increases. Close zeroizes capacity but file must be unloaded to do so.
     // Truncate can reduce logical, but capacity is not affected. It is always
     // safe to write past current logical within current capacity.
-    const auto allocated = size();
+    // A read-only map reads to capacity, as a concurrent writer may have
+    // committed records beyond the logical size last followed.
+    const auto allocated = read_only_ ? capacity() : size();
 
     // Takes a shared lock on remap_mutex_ until destruct, blocking remap.
     const auto ptr = std::make_shared<access>(remap_mutex_);
 
     // loaded_ update is precluded by remap_mutex_, making this read atomic.
-    if (!loaded_ || is_null(ptr))
+    if (!loaded_ || is_null(ptr) || is_null(memory_map_))
         return nullptr;
 
+    // A read-only map shrinks when following a truncated file (see expand).
+    // capacity_ is written only under exclusive remap_mutex_ (map_/unmap_),
+    // so it is stable here and bounds a capacity obtained before the lock.
+    const auto end = read_only_ ? std::min(allocated, capacity_) : allocated;
+
     // With offset > size the assignment is negative (stream is exhausted).
     BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
-    ptr->assign(memory_map_ + offset, memory_map_ + allocated);
+    ptr->assign(memory_map_ + offset, memory_map_ + end);
     BC_POP_WARNING()
     return ptr;
 }
@@ -366,7 +404,7 @@ memory_ptr map::get_capacity(size_t offset) const NOEXCEPT
     // Same as get() but limited by capacity() vs. size().
     const auto allocated = capacity();
     const auto ptr = std::make_shared<access>(remap_mutex_);
-    if (!loaded_ || is_null(ptr))
+    if (!loaded_ || is_null(ptr) || is_null(memory_map_))
         return nullptr;
 
     BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
@@ -435,6 +473,35 @@ void map::set_disk_space(size_t required) NOEXCEPT
 
 constexpr auto fail = -1;
 
+#if !defined (WITHOUT_MADVISE)
+#if !defined(HAVE_MSC)
+// Unsupported advice (e.g. cold prior to linux 5.4) is fail.
+constexpr int to_advice(advice_t advice) NOEXCEPT
+{
+    switch (advice)
+    {
+        case advice_t::normal: return MADV_NORMAL;
+        case advice_t::random: return MADV_RANDOM;
+        case advice_t::sequential: return MADV_SEQUENTIAL;
+        case advice_t::willneed: return MADV_WILLNEED;
+        case advice_t::dontneed: return MADV_DONTNEED;
+#if defined(MADV_COLD)
+        case advice_t::cold: return MADV_COLD;
+#endif
+#if defined(MADV_POPULATE_READ)
+        case advice_t::populate: return MADV_POPULATE_READ;
+#endif
+#if defined(MADV_PAGEOUT)
+        case advice_t::pageout: return MADV_PAGEOUT;
+#elif defined(MADV_COLD)
+        case advice_t::pageout: return MADV_COLD;
+#endif
+        default: return fail;
+    }
+}
+#endif
+#endif // WITHOUT_MADVISE
+
 // Never results in unmapped.
 bool map::flush_() NOEXCEPT
 {
@@ -470,6 +537,21 @@ bool map::flush_() NOEXCEPT
 // Trims to logical size, can be zero.
 bool map::unmap_() NOEXCEPT
 {
+    // Read-only map is never resized or synced, and may be empty (unmapped).
+    if (read_only_)
+    {
+        const auto success = is_null(memory_map_) ||
+            (::munmap(memory_map_, capacity_) != fail);
+
+        if (!success)
+            set_first_code(error::munmap_failure);
+
+        loaded_ = false;
+        capacity_ = zero;
+        memory_map_ = {};
+        return success;
+    }
+
 #if defined(HAVE_MSC)
     const auto success =
            (::msync(memory_map_, logical_, MS_SYNC) != fail)
@@ -498,6 +580,31 @@ bool map::unmap_() NOEXCEPT
 // Mapping has no effect on logical size, always maps max(logical, min) size.
 bool map::map_() NOEXCEPT
 {
+    // Read-only maps the full file, which cannot be resized here.
+    if (read_only_)
+    {
+        size_t size{};
+        if (file::size_ex(size, opened_))
+        {
+            set_first_code(error::mmap_failure);
+            return false;
+        }
+
+        // An empty file cannot be mapped, so is loaded without a map.
+        if (is_zero(size))
+        {
+            loaded_ = true;
+            capacity_ = zero;
+            memory_map_ = {};
+            return true;
+        }
+
+        memory_map_ = pointer_cast<uint8_t>(::mmap(nullptr, size, PROT_READ,
+            MAP_SHARED, opened_, 0));
+
+        return finalize_(size);
+    }
+
     auto size = logical_;
 
     // Cannot map empty file, and want mininum capacity, so expand as required.
@@ -615,8 +722,10 @@ bool map::finalize_(size_t size) NOEXCEPT
 
     // Use 1GB chunks to avoid large-length issues.
     constexpr auto chunk = power2(30u);
-    const auto advice = (random_ ? MADV_RANDOM : MADV_SEQUENTIAL) |
-        MADV_WILLNEED;
+
+    // Advice values are not flags, so the retained whole-map access pattern
+    // and willneed are applied by separate calls.
+    const auto pattern = to_advice(pattern_.load(std::memory_order_relaxed));
 
     for (auto offset = zero; offset < align; offset += chunk)
     {
@@ -624,7 +733,9 @@ bool map::finalize_(size_t size) NOEXCEPT
         const auto start = memory_map_ + offset;
         BC_POP_WARNING()
 
-        if (::madvise(start, std::min(chunk, align - offset), advice) == fail)
+        const auto length = std::min(chunk, align - offset);
+        if (::madvise(start, length, pattern) == fail ||
+            ::madvise(start, length, MADV_WILLNEED) == fail)
         {
             set_first_code(error::madvise_failure);
             unmap_();
@@ -639,6 +750,148 @@ bool map::finalize_(size_t size) NOEXCEPT
     return true;
 }
 
+// advice
+// ----------------------------------------------------------------------------
+
+code map::advise(advice_t advice, size_t offset, size_t size) NOEXCEPT
+{
+    // Whole-map access pattern is retained and reapplied upon remap.
+    if (is_zero(offset) && size == eof && (advice == advice_t::normal ||
+        advice == advice_t::random || advice == advice_t::sequential))
+        pattern_.store(advice, std::memory_order_relaxed);
+
+#if !defined (WITHOUT_MADVISE)
+#if !defined(HAVE_MSC)
+    // Lock, unlock and populate (if not supported) are not madvise values.
+    const auto direct = (advice == advice_t::lock ||
+        advice == advice_t::unlock || advice == advice_t::populate);
+    const auto value = to_advice(advice);
+    if (value == fail && !direct)
+        return error::success;
+
+    const int page_size = ::sysconf(_SC_PAGESIZE);
+    const auto page = possible_narrow_sign_cast<size_t>(page_size);
+    if (page_size == fail || !is_one(ones_count(page)))
+        return error::sysconf_failure;
+
+    // Populate by sequential touch, one read per page.
+    const auto touch = [page](const uint8_t* address, size_t length) NOEXCEPT
+    {
+        volatile uint8_t sink{};
+        const volatile uint8_t* bytes = address;
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        for (auto byte = zero; byte < length; byte += page)
+            sink = *(bytes + byte);
+        BC_POP_WARNING()
+    };
+
+    // Start must be page aligned, end is clamped to capacity.
+    const auto start = bit_and(offset, bit_not(sub1(page)));
+    const auto last = ceilinged_add(offset, size);
+
+    // Use 1GB chunks to avoid large-length issues. The remap lock is released
+    // between chunks, so that a long advice (e.g. populate) does not stall
+    // allocation, and the map is revalidated for each chunk.
+    constexpr auto chunk = power2(30u);
+    for (auto position = start; position < last; position += chunk)
+    {
+        // Obtaining capacity before remap lock prevents mutual mutex wait.
+        const auto allocated = capacity();
+
+        // Shared lock on remap_mutex_ precludes remap during chunk advice.
+        std::shared_lock remap_lock(remap_mutex_);
+        if (!loaded_)
+            return error::unloaded_file;
+
+        const auto end = std::min(last, allocated);
+        if (position >= end)
+            break;
+
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        const auto address = memory_map_ + position;
+        BC_POP_WARNING()
+
+        const auto length = std::min(chunk, end - position);
+        if (advice == advice_t::lock)
+        {
+            if (::mlock(address, length) == fail)
+                return error::mlock_failure;
+        }
+        else if (advice == advice_t::unlock)
+        {
+            if (::munlock(address, length) == fail)
+                return error::mlock_failure;
+        }
+        else if (value == fail)
+        {
+            touch(address, length);
+        }
+        else if (::madvise(address, length, value) == fail)
+        {
+            // Populate is defined by headers but rejected by linux < 5.14.
+            if (advice != advice_t::populate || errno != EINVAL)
+                return error::madvise_failure;
+
+            touch(address, length);
+        }
+    }
+#endif
+#endif // WITHOUT_MADVISE
+
+    return error::success;
+}
+
+size_t map::resident() const NOEXCEPT
+{
+#if !defined(HAVE_MSC)
+    // Obtaining capacity before remap lock prevents mutual mutex wait.
+    const auto allocated = capacity();
+
+    // Shared lock on remap_mutex_ precludes remap during sampling.
+    std::shared_lock remap_lock(remap_mutex_);
+    if (!loaded_ || is_zero(allocated))
+        return zero;
+
+    const int page_size = ::sysconf(_SC_PAGESIZE);
+    const auto page = possible_narrow_sign_cast<size_t>(page_size);
+    if (page_size == fail || !is_one(ones_count(page)))
+        return zero;
+
+    // Sample 1GB chunks to bound the page vector.
+    constexpr auto chunk = power2(30u);
+    std::vector<unsigned char> pages(ceilinged_divide(chunk, page));
+    auto pages_resident = zero;
+    for (auto position = zero; position < allocated; position += chunk)
+    {
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        const auto address = memory_map_ + position;
+        BC_POP_WARNING()
+
+        const auto length = std::min(chunk, allocated - position);
+#if defined(HAVE_APPLE)
+        BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+        const auto vector = reinterpret_cast<char*>(pages.data());
+        BC_POP_WARNING()
+#else
+        const auto vector = pages.data();
+#endif
+        if (::mincore(address, length, vector) == fail)
+            return zero;
+
+        const auto count = ceilinged_divide(length, page);
+        pages_resident += std::count_if(pages.begin(),
+            std::next(pages.begin(), count), [](unsigned char flags) NOEXCEPT
+            {
+                return to_bool(flags & 1u);
+            });
+    }
+
+    return pages_resident * page;
+#else
+    return zero;
+#endif
+}
+
 BC_POP_WARNING()
 
 } // namespace database
@@ -69,6 +69,12 @@ settings::settings() NOEXCEPT
     strong_tx_size{ 1 },
     strong_tx_rate{ 50 },
 
+    spent_size{ 1 },
+    spent_rate{ 50 },
+
+    subroot_size{ 1 },
+    subroot_rate{ 50 },
+
     // Caches.
 
     duplicate_buckets{ 128 },
@@ -86,6 +92,7 @@ settings::settings() NOEXCEPT
     validated_tx_buckets{ 128 },
     validated_tx_size{ 1 },
     validated_tx_rate{ 50 },
+    validated_tx_window{ 0 },
 
     // Optionals.
 
@@ -99,7 +106,16 @@ settings::settings() NOEXCEPT
 
     filter_tx_buckets{ 128 },
     filter_tx_size{ 1 },
-    filter_tx_rate{ 50 }
+    filter_tx_rate{ 50 },
+
+    fee_bk_buckets{ 128 },
+    fee_bk_size{ 1 },
+    fee_bk_rate{ 50 },
+
+    pool_buckets{ 128 },
+    pool_size{ 1 },
+    pool_rate{ 50 },
+    pool_limit{ 0 }
 {
 }
 
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/types/hash_bloom.hpp>
+
+#include <atomic>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+constexpr auto relaxed = std::memory_order_relaxed;
+
+hash_bloom::hash_bloom(size_t limit) NOEXCEPT
+  : blocks_(limit / block_bytes),
+    words_(blocks_ * block_words)
+{
+}
+
+bool hash_bloom::enabled() const NOEXCEPT
+{
+    return is_nonzero(blocks_);
+}
+
+bool hash_bloom::loaded() const NOEXCEPT
+{
+    return loaded_.load(std::memory_order_acquire);
+}
+
+bool hash_bloom::contains(const hash_digest& key) const NOEXCEPT
+{
+    using namespace system;
+    if (!enabled() || !loaded())
+        return true;
+
+    const auto block = to_block(key);
+    for (size_t index{}; index < key_bits; ++index)
+    {
+        const auto bit = to_bit(key, index);
+        const auto& word = words_[block + (bit / word_bits)];
+        if (!get_right(word.load(relaxed), bit % word_bits))
+            return false;
+    }
+
+    return true;
+}
+
+void hash_bloom::insert(const hash_digest& key) NOEXCEPT
+{
+    using namespace system;
+    if (!enabled())
+        return;
+
+    const auto block = to_block(key);
+    for (size_t index{}; index < key_bits; ++index)
+    {
+        const auto bit = to_bit(key, index);
+        auto& word = words_[block + (bit / word_bits)];
+        word.fetch_or(bit_right<uint64_t>(bit % word_bits), relaxed);
+    }
+}
+
+void hash_bloom::load() NOEXCEPT
+{
+    loaded_.store(true, std::memory_order_release);
+}
+
+void hash_bloom::unload() NOEXCEPT
+{
+    loaded_.store(false, std::memory_order_release);
+    for (auto& word: words_)
+        word.store(0, relaxed);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+// Offset of the first word of the key's block, from the first eight bytes.
+size_t hash_bloom::to_block(const hash_digest& key) const NOEXCEPT
+{
+    using namespace system;
+    uint64_t value{};
+    for (size_t byte{}; byte < sizeof(uint64_t); ++byte)
+        value |= shift_left<uint64_t>(key[byte], to_bits(byte));
+
+    return (value % blocks_) * block_words;
+}
+
+// Bit within the block, from two bytes following the block selector.
+size_t hash_bloom::to_bit(const hash_digest& key, size_t index) NOEXCEPT
+{
+    using namespace system;
+    const auto byte = sizeof(uint64_t) + index * sizeof(uint16_t);
+    const auto value = bit_or<size_t>(key[byte],
+        shift_left<size_t>(key[add1(byte)], byte_bits));
+
+    return value % block_bits;
+}
+
+} // namespace database
+} // namespace libbitcoin
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/types/short_ids.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <mutex>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// SipHash-2-4 (Aumasson and Bernstein), as specified by BIP152.
+// ----------------------------------------------------------------------------
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+static constexpr uint64_t to_word(const uint8_t* data) NOEXCEPT
+{
+    uint64_t value{};
+    for (size_t byte{}; byte < sizeof(uint64_t); ++byte)
+        value |= static_cast<uint64_t>(data[byte]) << to_bits(byte);
+
+    return value;
+}
+
+static constexpr void sipround(uint64_t& v0, uint64_t& v1, uint64_t& v2,
+    uint64_t& v3) NOEXCEPT
+{
+    v0 += v1; v1 = std::rotl(v1, 13); v1 ^= v0; v0 = std::rotl(v0, 32);
+    v2 += v3; v3 = std::rotl(v3, 16); v3 ^= v2;
+    v0 += v3; v3 = std::rotl(v3, 21); v3 ^= v0;
+    v2 += v1; v1 = std::rotl(v1, 17); v1 ^= v2; v2 = std::rotl(v2, 32);
+}
+
+uint64_t short_ids::siphash(const key& key, const data_slice& message) NOEXCEPT
+{
+    auto v0 = key.k0 ^ 0x736f6d6570736575;
+    auto v1 = key.k1 ^ 0x646f72616e646f6d;
+    auto v2 = key.k0 ^ 0x6c7967656e657261;
+    auto v3 = key.k1 ^ 0x7465646279746573;
+
+    const auto size = message.size();
+    const auto data = message.data();
+    const auto blocks = size - (size % sizeof(uint64_t));
+    for (size_t offset{}; offset < blocks; offset += sizeof(uint64_t))
+    {
+        const auto word = to_word(std::next(data, offset));
+        v3 ^= word;
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        v0 ^= word;
+    }
+
+    // Final word carries the message size (mod 256) in its high byte.
+    auto last = static_cast<uint64_t>(size) << 56;
+    for (auto byte = blocks; byte < size; ++byte)
+        last |= static_cast<uint64_t>(data[byte]) << to_bits(byte - blocks);
+
+    v3 ^= last;
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    v0 ^= last;
+
+    v2 ^= 0xff;
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+short_ids::key short_ids::to_key(const data_slice& header,
+    uint64_t nonce) NOEXCEPT
+{
+    // k0/k1 are the first two little endian words of sha256(header || nonce).
+    data_chunk data(header.begin(), header.end());
+    for (size_t byte{}; byte < sizeof(uint64_t); ++byte)
+        data.push_back(static_cast<uint8_t>(nonce >> to_bits(byte)));
+
+    const auto hash = system::sha256_hash(data);
+    return
+    {
+        to_word(hash.data()),
+        to_word(std::next(hash.data(), sizeof(uint64_t)))
+    };
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+uint64_t short_ids::to_id(const key& key, const hash_digest& hash) NOEXCEPT
+{
+    constexpr auto mask = sub1(uint64_t{ 1 } << to_bits(id_bytes));
+    return siphash(key, hash) & mask;
+}
+
+std::vector<uint64_t> short_ids::find(const map& map, uint64_t id) NOEXCEPT
+{
+    const auto by_id = [](const auto& left, const auto& right) NOEXCEPT
+    {
+        return left.first < right.first;
+    };
+
+    std::vector<uint64_t> out{};
+    const auto range = std::equal_range(map.begin(), map.end(),
+        short_ids::id{ id, {} }, by_id);
+    for (auto it = range.first; it != range.second; ++it)
+        out.push_back(it->second);
+
+    return out;
+}
+
+// ring
+// ----------------------------------------------------------------------------
+
+short_ids::short_ids(size_t capacity) NOEXCEPT
+  : capacity_(capacity)
+{
+}
+
+bool short_ids::enabled() const NOEXCEPT
+{
+    return is_nonzero(capacity_);
+}
+
+size_t short_ids::capacity() const NOEXCEPT
+{
+    return capacity_;
+}
+
+void short_ids::push(uint64_t link, const hash_digest& hash) NOEXCEPT
+{
+    if (!enabled())
+        return;
+
+    std::unique_lock lock{ mutex_ };
+    if (ring_.size() < capacity_)
+        ring_.push_back({ link, hash });
+    else
+        ring_.at(sequence_ % capacity_) = { link, hash };
+
+    ++sequence_;
+}
+
+size_t short_ids::snapshot(entries& out) const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    out = ring_;
+    return sequence_;
+}
+
+bool short_ids::since(entries& out, size_t& sequence) const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    if (sequence > sequence_ || (sequence_ - sequence) > ring_.size())
+        return false;
+
+    // Slot of a push is its sequence modulo capacity.
+    out.reserve(sequence_ - sequence);
+    for (auto push = sequence; push < sequence_; ++push)
+        out.push_back(ring_.at(push % capacity_));
+
+    sequence = sequence_;
+    return true;
+}
+
+short_ids::map_cptr short_ids::get(const key& key,
+    size_t& sequence) const NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    for (const auto& entry: cache_)
+    {
+        if (entry.map && entry.value == key)
+        {
+            sequence = entry.sequence;
+            return entry.map;
+        }
+    }
+
+    return {};
+}
+
+void short_ids::put(const key& key, size_t sequence,
+    const map_cptr& map) NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    for (auto& entry: cache_)
+    {
+        // Replace the (extended) map of the same key.
+        if (entry.map && entry.value == key)
+        {
+            entry = { key, sequence, map };
+            return;
+        }
+    }
+
+    cache_.at(next_++ % cache_count) = { key, sequence, map };
+}
+
+void short_ids::clear() NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    ring_.clear();
+    cache_ = {};
+    sequence_ = zero;
+    next_ = zero;
+}
+
+} // namespace database
+} // namespace libbitcoin
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/types/wire_cache.hpp>
+
+#include <mutex>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+constexpr auto relaxed = std::memory_order_relaxed;
+
+wire_cache::wire_cache(size_t capacity) NOEXCEPT
+  : limit_(capacity / shard_count)
+{
+}
+
+bool wire_cache::enabled() const NOEXCEPT
+{
+    return is_nonzero(limit_);
+}
+
+wire_cache::chunk_cptr wire_cache::get(uint32_t link,
+    kind type) const NOEXCEPT
+{
+    if (!enabled())
+        return {};
+
+    auto& shard = to_shard(link);
+    const auto value = to_key(link, type);
+
+    std::unique_lock lock{ shard.mutex };
+    const auto it = shard.map.find(value);
+    if (it == shard.map.end())
+    {
+        misses_.fetch_add(one, relaxed);
+        return {};
+    }
+
+    // Promote to most recently used (no allocation).
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    hits_.fetch_add(one, relaxed);
+    return it->second->second;
+}
+
+void wire_cache::put(uint32_t link, kind type,
+    const chunk_cptr& data) NOEXCEPT
+{
+    const auto payload = data ? data->size() : zero;
+    const auto size = payload + overhead();
+    if (!enabled() || is_zero(payload) || size > limit_)
+        return;
+
+    auto& shard = to_shard(link);
+    const auto value = to_key(link, type);
+
+    std::unique_lock lock{ shard.mutex };
+    remove(shard, value);
+
+    while (!shard.lru.empty() && (shard.bytes + size > limit_))
+        remove(shard, shard.lru.back().first);
+
+    shard.lru.emplace_front(value, data);
+    shard.map.emplace(value, shard.lru.begin());
+    shard.bytes += size;
+}
+
+void wire_cache::erase(uint32_t link) NOEXCEPT
+{
+    if (!enabled())
+        return;
+
+    auto& shard = to_shard(link);
+    std::unique_lock lock{ shard.mutex };
+    remove(shard, to_key(link, kind::header));
+    remove(shard, to_key(link, kind::block));
+    remove(shard, to_key(link, kind::witness_block));
+    remove(shard, to_key(link, kind::merkle_tree));
+}
+
+void wire_cache::clear() NOEXCEPT
+{
+    for (auto& shard: shards_)
+    {
+        std::unique_lock lock{ shard.mutex };
+        shard.map.clear();
+        shard.lru.clear();
+        shard.bytes = zero;
+    }
+}
+
+wire_cache::metrics wire_cache::get_metrics() const NOEXCEPT
+{
+    metrics out{ hits_.load(relaxed), misses_.load(relaxed), zero, zero };
+    for (auto& shard: shards_)
+    {
+        std::unique_lock lock{ shard.mutex };
+        out.entries += shard.map.size();
+        out.bytes += shard.bytes;
+    }
+
+    return out;
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+wire_cache::shard& wire_cache::to_shard(uint32_t link) const NOEXCEPT
+{
+    return shards_.at(link % shard_count);
+}
+
+// Caller must hold the shard lock.
+void wire_cache::remove(shard& shard, key value) NOEXCEPT
+{
+    const auto it = shard.map.find(value);
+    if (it == shard.map.end())
+        return;
+
+    shard.bytes -= it->second->second->size() + overhead();
+    shard.lru.erase(it->second);
+    shard.map.erase(it);
+}
+
+} // namespace database
+} // namespace libbitcoin
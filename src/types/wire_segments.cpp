@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/types/wire_segments.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+size_t wire_segments::size() const NOEXCEPT
+{
+    return std::accumulate(segments.cbegin(), segments.cend(), zero,
+        [](size_t total, const wire_segment& segment) NOEXCEPT
+        {
+            return total + segment.size;
+        });
+}
+
+data_chunk wire_segments::to_chunk() const NOEXCEPT
+{
+    data_chunk out(size());
+    auto it = out.begin();
+    for (const auto& segment: segments)
+        it = std::copy_n(segment.data, segment.size, it);
+
+    return out;
+}
+
+void wire_segments::reset() NOEXCEPT
+{
+    // Segments reference scratch and guarded memory, so clear them first.
+    segments.clear();
+    scratch.clear();
+    guards.clear();
+}
+
+} // namespace database
+} // namespace libbitcoin
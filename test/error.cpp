@@ -252,6 +252,15 @@ BOOST_AUTO_TEST_CASE(error_t__code__madvise_failure__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "madvise failure");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__mlock_failure__true_expected_message)
+{
+    constexpr auto value = error::mlock_failure;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "mlock failure");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__sysconf_failure__true_expected_message)
 {
     constexpr auto value = error::sysconf_failure;
@@ -387,6 +396,24 @@ BOOST_AUTO_TEST_CASE(error_t__code__unloaded_file__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "file not loaded");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__read_only_store__true_expected_message)
+{
+    constexpr auto value = error::read_only_store;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "store is read only");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__pending_prune__true_expected_message)
+{
+    constexpr auto value = error::pending_prune;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "prune pending snapshot");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__create_table__true_expected_message)
 {
     constexpr auto value = error::create_table;
@@ -441,6 +468,33 @@ BOOST_AUTO_TEST_CASE(error_t__code__verify_table__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "failed to verify table");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__migrate_table__true_expected_message)
+{
+    constexpr auto value = error::migrate_table;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "failed to migrate table");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__follow_table__true_expected_message)
+{
+    constexpr auto value = error::follow_table;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "failed to follow table");
+}
+
+BOOST_AUTO_TEST_CASE(error_t__code__publish_table__true_expected_message)
+{
+    constexpr auto value = error::publish_table;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "failed to publish table");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__tx_connected__true_expected_message)
 {
     constexpr auto value = error::tx_connected;
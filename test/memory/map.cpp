@@ -776,4 +776,127 @@ BOOST_AUTO_TEST_CASE(map__unload__shared__unload_locked)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(map__advise__loaded__success)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, 1, 0, false);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_NE(instance.allocate(100), storage::eof);
+    BOOST_REQUIRE(!instance.advise(advice_t::random));
+    BOOST_REQUIRE(!instance.advise(advice_t::willneed, 10, 20));
+    BOOST_REQUIRE(!instance.advise(advice_t::cold, 50));
+    BOOST_REQUIRE(!instance.advise(advice_t::dontneed, 1000, 10));
+    BOOST_REQUIRE(!instance.advise(advice_t::populate));
+    BOOST_REQUIRE_NE(instance.allocate(10000), storage::eof);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__resident__unloaded__zero)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE_EQUAL(instance.resident(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(map__resident__written__within_capacity)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+
+    auto memory = instance.get(instance.allocate(100));
+    BOOST_REQUIRE(memory);
+    *memory->begin() = 42;
+    memory.reset();
+
+    // Page granularity may exceed capacity.
+    BOOST_REQUIRE(instance.resident() <= system::power2(20u));
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__read_only__empty__loaded_null)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, 1, 0, true, true);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE(instance.is_loaded());
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 0u);
+    BOOST_REQUIRE(!instance.get());
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), storage::eof);
+    BOOST_REQUIRE(!instance.reserve(1));
+    BOOST_REQUIRE(!instance.flush());
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(map__read_only__follow_writer__expected)
+{
+    constexpr uint64_t expected = 0x0102030405060708_u64;
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map writer(file);
+    BOOST_REQUIRE(!writer.open());
+    BOOST_REQUIRE(!writer.load());
+
+    auto memory = writer.get(writer.allocate(sizeof(uint64_t)));
+    BOOST_REQUIRE(memory);
+    system::unsafe_to_little_endian<uint64_t>(memory->begin(), expected);
+    memory.reset();
+
+    map reader(file, 1, 0, true, true);
+    BOOST_REQUIRE(!reader.open());
+    BOOST_REQUIRE(!reader.load());
+    BOOST_REQUIRE(reader.expand(sizeof(uint64_t)));
+    BOOST_REQUIRE_EQUAL(reader.size(), sizeof(uint64_t));
+    BOOST_REQUIRE_EQUAL(reader.allocate(1), storage::eof);
+
+    memory = reader.get();
+    BOOST_REQUIRE(memory);
+    BOOST_REQUIRE_EQUAL(system::unsafe_from_little_endian<uint64_t>(memory->begin()), expected);
+    memory.reset();
+
+    // Reader remaps as the writer grows the file.
+    BOOST_REQUIRE_NE(writer.allocate(100000), storage::eof);
+    BOOST_REQUIRE(reader.expand(writer.size()));
+    BOOST_REQUIRE_EQUAL(reader.size(), writer.size());
+    BOOST_REQUIRE(reader.capacity() >= writer.size());
+    BOOST_REQUIRE(!reader.expand(add1(reader.capacity())));
+
+    // Reader remaps as the writer truncates the file (e.g. prune).
+    BOOST_REQUIRE(writer.truncate(zero));
+    BOOST_REQUIRE(!writer.unload());
+    BOOST_REQUIRE(!writer.load());
+    BOOST_REQUIRE(reader.expand(zero));
+    BOOST_REQUIRE_EQUAL(reader.size(), zero);
+    BOOST_REQUIRE_EQUAL(reader.capacity(), writer.capacity());
+    memory = reader.get();
+    BOOST_REQUIRE(memory);
+    BOOST_REQUIRE_EQUAL(system::to_unsigned(memory->size()), reader.capacity());
+    memory.reset();
+
+    BOOST_REQUIRE(!reader.unload());
+    BOOST_REQUIRE(!reader.close());
+    BOOST_REQUIRE(!reader.get_fault());
+    BOOST_REQUIRE(!writer.unload());
+    BOOST_REQUIRE(!writer.close());
+    BOOST_REQUIRE(!writer.get_fault());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -40,7 +40,7 @@ chunk_storage::chunk_storage(system::data_chunk& reference) NOEXCEPT
 }
 
 chunk_storage::chunk_storage(const std::filesystem::path& filename,
-    size_t, size_t, bool) NOEXCEPT
+    size_t, size_t, bool, bool) NOEXCEPT
   : buffer_{ local_ }, path_{ filename }, logical_{}
 {
 }
@@ -224,6 +224,16 @@ size_t chunk_storage::get_space() const NOEXCEPT
     return {};
 }
 
+code chunk_storage::advise(advice_t, size_t, size_t) NOEXCEPT
+{
+    return {};
+}
+
+size_t chunk_storage::resident() const NOEXCEPT
+{
+    return size();
+}
+
 BC_POP_WARNING()
 
 } // namespace test
@@ -32,7 +32,7 @@ public:
     chunk_storage() NOEXCEPT;
     chunk_storage(system::data_chunk& reference) NOEXCEPT;
     chunk_storage(const std::filesystem::path& filename, size_t minimum=1,
-        size_t expansion=0, bool random=true) NOEXCEPT;
+        size_t expansion=0, bool random=true, bool read_only=false) NOEXCEPT;
 
     // test side door.
     system::data_chunk& buffer() NOEXCEPT;
@@ -57,6 +57,9 @@ public:
     memory::iterator get_raw(size_t offset=zero) const NOEXCEPT override;
     code get_fault() const NOEXCEPT override;
     size_t get_space() const NOEXCEPT override;
+    code advise(advice_t advice, size_t offset=zero,
+        size_t size=eof) NOEXCEPT override;
+    size_t resident() const NOEXCEPT override;
 
 private:
     // These are protected by mutex.
@@ -146,6 +146,26 @@ public:
         return strong_tx_body_.buffer();
     }
 
+    system::data_chunk& spent_head() NOEXCEPT
+    {
+        return spent_head_.buffer();
+    }
+
+    system::data_chunk& spent_body() NOEXCEPT
+    {
+        return spent_body_.buffer();
+    }
+
+    system::data_chunk& subroot_head() NOEXCEPT
+    {
+        return subroot_head_.buffer();
+    }
+
+    system::data_chunk& subroot_body() NOEXCEPT
+    {
+        return subroot_body_.buffer();
+    }
+
     // Caches.
 
     system::data_chunk& duplicate_head() NOEXCEPT
@@ -168,6 +188,16 @@ public:
         return prevout_body_.buffer();
     }
 
+    system::data_chunk& prevout1_head() NOEXCEPT
+    {
+        return prevout1_head_.buffer();
+    }
+
+    system::data_chunk& prevout1_body() NOEXCEPT
+    {
+        return prevout1_body_.buffer();
+    }
+
     system::data_chunk& validated_bk_head() NOEXCEPT
     {
         return validated_bk_head_.buffer();
@@ -188,6 +218,16 @@ public:
         return validated_tx_body_.buffer();
     }
 
+    system::data_chunk& validated_tx1_head() NOEXCEPT
+    {
+        return validated_tx1_head_.buffer();
+    }
+
+    system::data_chunk& validated_tx1_body() NOEXCEPT
+    {
+        return validated_tx1_body_.buffer();
+    }
+
     // Optionals.
 
     system::data_chunk& address_head() NOEXCEPT
@@ -219,6 +259,36 @@ public:
     {
         return filter_tx_body_.buffer();
     }
+
+    system::data_chunk& fee_bk_head() NOEXCEPT
+    {
+        return fee_bk_head_.buffer();
+    }
+
+    system::data_chunk& fee_bk_body() NOEXCEPT
+    {
+        return fee_bk_body_.buffer();
+    }
+
+    system::data_chunk& pool0_head() NOEXCEPT
+    {
+        return pool0_head_.buffer();
+    }
+
+    system::data_chunk& pool0_body() NOEXCEPT
+    {
+        return pool0_body_.buffer();
+    }
+
+    system::data_chunk& pool1_head() NOEXCEPT
+    {
+        return pool1_head_.buffer();
+    }
+
+    system::data_chunk& pool1_body() NOEXCEPT
+    {
+        return pool1_body_.buffer();
+    }
 };
 
 using query_accessor = query<store<chunk_storage>>;
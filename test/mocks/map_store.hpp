@@ -167,6 +167,26 @@ public:
         return strong_tx_body_.file();
     }
 
+    inline const path& spent_head_file() const NOEXCEPT
+    {
+        return spent_head_.file();
+    }
+
+    inline const path& spent_body_file() const NOEXCEPT
+    {
+        return spent_body_.file();
+    }
+
+    inline const path& subroot_head_file() const NOEXCEPT
+    {
+        return subroot_head_.file();
+    }
+
+    inline const path& subroot_body_file() const NOEXCEPT
+    {
+        return subroot_body_.file();
+    }
+
     // Caches.
 
     inline const path& duplicate_head_file() const NOEXCEPT
@@ -189,6 +209,16 @@ public:
         return prevout_body_.file();
     }
 
+    inline const path& prevout1_head_file() const NOEXCEPT
+    {
+        return prevout1_head_.file();
+    }
+
+    inline const path& prevout1_body_file() const NOEXCEPT
+    {
+        return prevout1_body_.file();
+    }
+
     inline const path& validated_bk_head_file() const NOEXCEPT
     {
         return validated_bk_head_.file();
@@ -209,6 +239,16 @@ public:
         return validated_tx_body_.file();
     }
 
+    inline const path& validated_tx1_head_file() const NOEXCEPT
+    {
+        return validated_tx1_head_.file();
+    }
+
+    inline const path& validated_tx1_body_file() const NOEXCEPT
+    {
+        return validated_tx1_body_.file();
+    }
+
     // Optionals.
 
     inline const path& address_head_file() const NOEXCEPT
@@ -241,6 +281,36 @@ public:
         return filter_tx_body_.file();
     }
 
+    inline const path& fee_bk_head_file() const NOEXCEPT
+    {
+        return fee_bk_head_.file();
+    }
+
+    inline const path& fee_bk_body_file() const NOEXCEPT
+    {
+        return fee_bk_body_.file();
+    }
+
+    inline const path& pool0_head_file() const NOEXCEPT
+    {
+        return pool0_head_.file();
+    }
+
+    inline const path& pool0_body_file() const NOEXCEPT
+    {
+        return pool0_body_.file();
+    }
+
+    inline const path& pool1_head_file() const NOEXCEPT
+    {
+        return pool1_head_.file();
+    }
+
+    inline const path& pool1_body_file() const NOEXCEPT
+    {
+        return pool1_body_.file();
+    }
+
     // Locks.
 
     inline const path& flush_lock_file() const NOEXCEPT
@@ -626,6 +626,29 @@ BOOST_AUTO_TEST_CASE(nomap__record_body_count__non_empty_restore__truncates)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(nomap__record_at__push__expected)
+{
+    data_chunk head_file{};
+    data_chunk body_file{};
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    record_table instance{ head_store, body_store, 1 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.verify());
+    BOOST_REQUIRE_EQUAL(head_file, base16_chunk("0000000000ffffffffff"));
+    BOOST_REQUIRE(instance.at(0).is_terminal());
+    BOOST_REQUIRE(instance.at(1).is_terminal());
+
+    BOOST_REQUIRE(instance.push(42, 0));
+    BOOST_REQUIRE_EQUAL(instance.at(0), 42u);
+    BOOST_REQUIRE_EQUAL(head_file, base16_chunk("00000000002a00000000"));
+
+    // Body count is independent of head cells.
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_file, base16_chunk("00000000002a00000000"));
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 // slab create/close/backup/restore/verify
 // ----------------------------------------------------------------------------
 
@@ -153,6 +153,79 @@ BOOST_AUTO_TEST_CASE(query_chain_writer__set_link_header__is_header__expected)
     BOOST_CHECK_EQUAL(element1.nonce, header.nonce());
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_writer__set_headers__empty__success)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    header_links links{ 42 };
+    BOOST_CHECK(!query.set_code(links, header_entries{}));
+    BOOST_CHECK(links.empty());
+    BOOST_CHECK_EQUAL(store.header.count(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_writer__set_headers__chained__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    const header_entries entries
+    {
+        { test::block1.header_ptr(), context{ 1, 1, 11 }, false },
+        { test::block2.header_ptr(), context{ 2, 2, 22 }, true },
+        { test::block3.header_ptr(), context{ 3, 3, 33 }, false }
+    };
+
+    header_links links{};
+    BOOST_CHECK(!query.set_code(links, entries));
+    BOOST_CHECK_EQUAL(links.size(), 3u);
+    BOOST_CHECK_EQUAL(links.at(0), 1u);
+    BOOST_CHECK_EQUAL(links.at(1), 2u);
+    BOOST_CHECK_EQUAL(links.at(2), 3u);
+    BOOST_CHECK_EQUAL(query.to_header(test::block1.hash()), 1u);
+    BOOST_CHECK_EQUAL(query.to_header(test::block2.hash()), 2u);
+    BOOST_CHECK_EQUAL(query.to_header(test::block3.hash()), 3u);
+    BOOST_CHECK_EQUAL(query.to_parent(1), 0u);
+    BOOST_CHECK_EQUAL(query.to_parent(2), 1u);
+    BOOST_CHECK_EQUAL(query.to_parent(3), 2u);
+    BOOST_CHECK(!query.is_milestone(1));
+    BOOST_CHECK(query.is_milestone(2));
+    BOOST_CHECK(*query.get_header(3) == test::block3.header());
+
+    context ctx{};
+    BOOST_CHECK(query.get_context(ctx, 2));
+    BOOST_CHECK(ctx == context{ 2, 2, 22 });
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_writer__set_headers__orphan__orphan_block)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    const header_entries entries
+    {
+        { test::block2.header_ptr(), context{}, false },
+        { test::block3.header_ptr(), context{}, false }
+    };
+
+    header_links links{};
+    BOOST_CHECK_EQUAL(query.set_code(links, entries), system::error::orphan_block);
+    BOOST_CHECK(links.empty());
+    BOOST_CHECK_EQUAL(store.header.count(), 1u);
+}
+
 BOOST_AUTO_TEST_CASE(query_chain_writer__set_tx__empty__expected)
 {
     const system::chain::transaction tx{};
@@ -735,6 +808,40 @@ BOOST_AUTO_TEST_CASE(query_chain_writer__set_block_txs__get_block__expected)
     BOOST_CHECK_EQUAL(hashes, test::genesis.transaction_hashes(false));
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_writer__set_block__multiple_txs__same_as_set_txs)
+{
+    const auto& block = test::block_valid_spend_internal_2b;
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store1{ settings };
+    test::chunk_store store2{ settings };
+    test::query_accessor query1{ store1 };
+    test::query_accessor query2{ store2 };
+    BOOST_CHECK(!store1.create(test::events_handler));
+    BOOST_CHECK(!store2.create(test::events_handler));
+    BOOST_CHECK(query1.initialize(test::genesis));
+    BOOST_CHECK(query2.initialize(test::genesis));
+    BOOST_CHECK(query1.set(test::block1a, test::context, false, false));
+    BOOST_CHECK(query2.set(test::block1a, test::context, false, false));
+
+    // Block archival (one allocation per table) vs. individual tx archival.
+    BOOST_CHECK(query1.set(block, test::context, false, false));
+    for (const auto& tx: *block.transactions_ptr())
+        BOOST_CHECK(query2.set(*tx));
+
+    BOOST_CHECK_EQUAL(store1.tx_body(), store2.tx_body());
+    BOOST_CHECK_EQUAL(store1.point_body(), store2.point_body());
+    BOOST_CHECK_EQUAL(store1.input_body(), store2.input_body());
+    BOOST_CHECK_EQUAL(store1.output_body(), store2.output_body());
+    BOOST_CHECK_EQUAL(store1.ins_body(), store2.ins_body());
+    BOOST_CHECK_EQUAL(store1.outs_body(), store2.outs_body());
+    BOOST_CHECK_EQUAL(store1.address_body(), store2.address_body());
+
+    const auto pointer = query1.get_block(query1.to_header(block.hash()), true);
+    BOOST_CHECK(pointer);
+    BOOST_CHECK(*pointer == block);
+}
+
 // populate_with_metadata
 // ----------------------------------------------------------------------------
 
@@ -1475,6 +1582,25 @@ BOOST_AUTO_TEST_CASE(query_chain_writer__get_transactions__found__expected)
     BOOST_CHECK_EQUAL(query.get_transactions(2, false)->size(), 2u);
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_writer__get_transactions__turbo__expected)
+{
+    constexpr auto turbo = true;
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, test::context, false, false));
+    BOOST_CHECK(query.set(test::block2a, test::context, false, false));
+    BOOST_CHECK(!query.get_transactions(3, false, turbo));
+    BOOST_CHECK_EQUAL(query.get_transactions(2, false, turbo)->size(), 2u);
+
+    const auto pointer = query.get_block(2, true, turbo);
+    BOOST_CHECK(pointer);
+    BOOST_CHECK(*pointer == test::block2a);
+}
+
 BOOST_AUTO_TEST_CASE(query_chain_writer__get_spenders__unspent_or_not_found__expected)
 {
     settings settings{};
@@ -132,4 +132,77 @@ BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block__witness_false__expected)
     BOOST_CHECK(!store.close(test::events_handler));
 }
 
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block__turbo__expected)
+{
+    using namespace system;
+    constexpr auto turbo = true;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+    BOOST_CHECK_EQUAL(query.get_wire_block(2, true, turbo), test::block2a.to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_block(2, false, turbo), test::block2a.to_data(false));
+    BOOST_CHECK(query.get_wire_block(42, true, turbo).empty());
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block__cached__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.wire_cache_limit = 1024 * 1024;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+
+    // Miss populates, hit is served from the shared encoding.
+    BOOST_CHECK_EQUAL(query.get_wire_block(2, true), test::block2a.to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_block(2, true), test::block2a.to_data(true));
+    const auto block = query.get_cached_wire_block(2, true);
+    BOOST_CHECK(block);
+    BOOST_CHECK_EQUAL(*block, test::block2a.to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_header(2), test::block2a.header().to_data());
+    BOOST_CHECK(query.get_wire_block(42, true).empty());
+
+    auto metrics = query.get_wire_cache_metrics();
+    BOOST_CHECK_EQUAL(metrics.hits, 2u);
+    BOOST_CHECK_EQUAL(metrics.misses, 3u);
+    BOOST_CHECK_EQUAL(metrics.entries, 2u);
+
+    // Unstrong releases all encodings of the block.
+    BOOST_CHECK(query.set_unstrong(2));
+    metrics = query.get_wire_cache_metrics();
+    BOOST_CHECK_EQUAL(metrics.entries, 0u);
+    BOOST_CHECK_EQUAL(metrics.bytes, 0u);
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block__segments__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+
+    wire_segments out{};
+    BOOST_CHECK(query.get_wire_block(out, 2, true));
+    BOOST_CHECK_EQUAL(out.size(), test::block2a.serialized_size(true));
+    BOOST_CHECK_EQUAL(out.to_chunk(), test::block2a.to_data(true));
+    BOOST_CHECK(query.get_wire_block(out, 2, false));
+    BOOST_CHECK_EQUAL(out.to_chunk(), test::block2a.to_data(false));
+    BOOST_CHECK(query.get_wire_tx(out, 3, true));
+    BOOST_CHECK_EQUAL(out.to_chunk(), test::block2a.transactions_ptr()->at(1)->to_data(true));
+    BOOST_CHECK(!query.get_wire_block(out, 42, true));
+    BOOST_CHECK(out.segments.empty());
+    out.reset();
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
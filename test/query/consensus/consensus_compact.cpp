@@ -22,4 +22,57 @@
 
 BOOST_FIXTURE_TEST_SUITE(query_consensus_tests, test::directory_setup_fixture)
 
+BOOST_AUTO_TEST_CASE(query_consensus__get_short_ids__disabled__empty)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::tx4));
+
+    short_ids::key key{};
+    BOOST_REQUIRE(query.get_short_id_key(key, 0, 42));
+    BOOST_REQUIRE(query.get_short_ids(key)->empty());
+    BOOST_REQUIRE(!query.get_short_id_key(key, 1, 42));
+}
+
+BOOST_AUTO_TEST_CASE(query_consensus__to_short_id_txs__unconfirmed__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.short_id_limit = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, test::context, false, false));
+    BOOST_REQUIRE(query.set(test::tx4));
+
+    short_ids::key key{};
+    BOOST_REQUIRE(query.get_short_id_key(key, 0, 42));
+    BOOST_REQUIRE(key == short_ids::to_key(test::genesis.header().to_data(), 42));
+
+    // Block txs are not indexed.
+    const auto map = query.get_short_ids(key);
+    BOOST_REQUIRE_EQUAL(map->size(), 1u);
+    BOOST_REQUIRE(query.get_short_ids(key) == map);
+
+    const auto tx4 = query.to_tx(test::tx4.hash(false));
+    const auto id4 = short_ids::to_id(key, test::tx4.hash(true));
+    BOOST_REQUIRE_EQUAL(query.to_short_id_txs(key, id4), tx_links{ tx4.value });
+
+    // Cached map is extended when a tx is archived.
+    BOOST_REQUIRE(query.set(test::tx5));
+    const auto extended = query.get_short_ids(key);
+    BOOST_REQUIRE_EQUAL(extended->size(), 2u);
+    BOOST_REQUIRE(std::is_sorted(extended->begin(), extended->end()));
+    BOOST_REQUIRE(query.get_short_ids(key) == extended);
+
+    const auto tx5 = query.to_tx(test::tx5.hash(false));
+    const auto id5 = short_ids::to_id(key, test::tx5.hash(true));
+    BOOST_REQUIRE_EQUAL(query.to_short_id_txs(key, id5), tx_links{ tx5.value });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -51,13 +51,20 @@ BOOST_AUTO_TEST_CASE(query_extent__body_sizes__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.candidate_body_size(), schema::height::minrow);
     BOOST_REQUIRE_EQUAL(query.confirmed_body_size(), schema::height::minrow);
     BOOST_REQUIRE_EQUAL(query.strong_tx_body_size(), schema::strong_tx::minrow);
+    BOOST_REQUIRE_EQUAL(query.spent_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.subroot_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.duplicate_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.prevout_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.prevout1_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.validated_bk_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.validated_tx_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.validated_tx1_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.filter_bk_body_size(), schema::filter_bk::minrow);
     BOOST_REQUIRE_EQUAL(query.filter_tx_body_size(), 5u);
     BOOST_REQUIRE_EQUAL(query.address_body_size(), schema::address::minrow);
+    BOOST_REQUIRE_EQUAL(query.fee_bk_body_size(), schema::fee_bk::minrow);
+    BOOST_REQUIRE_EQUAL(query.pool0_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.pool1_body_size(), zero);
 }
 
 BOOST_AUTO_TEST_CASE(query_extent__buckets__genesis__expected)
@@ -77,11 +84,16 @@ BOOST_AUTO_TEST_CASE(query_extent__buckets__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.strong_tx_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.duplicate_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.prevout_buckets(), 128);
+    BOOST_REQUIRE_EQUAL(query.prevout1_buckets(), 128);
     BOOST_REQUIRE_EQUAL(query.validated_tx_buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(query.validated_tx1_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.validated_bk_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.filter_tx_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.filter_bk_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.address_buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(query.fee_bk_buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(query.pool0_buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(query.pool1_buckets(), 128u);
 }
 
 BOOST_AUTO_TEST_CASE(query_extent__records__genesis__expected)
@@ -101,9 +113,12 @@ BOOST_AUTO_TEST_CASE(query_extent__records__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.candidate_records(), one);
     BOOST_REQUIRE_EQUAL(query.confirmed_records(), one);
     BOOST_REQUIRE_EQUAL(query.strong_tx_records(), one);
+    BOOST_REQUIRE_EQUAL(query.spent_records(), zero);
+    BOOST_REQUIRE_EQUAL(query.subroot_records(), zero);
     BOOST_REQUIRE_EQUAL(query.duplicate_records(), zero);
     BOOST_REQUIRE_EQUAL(query.filter_bk_records(), one);
     BOOST_REQUIRE_EQUAL(query.address_records(), one);
+    BOOST_REQUIRE_EQUAL(query.fee_bk_records(), one);
 }
 
 BOOST_AUTO_TEST_CASE(query_extent__input_output_count__genesis__expected)
@@ -453,4 +453,58 @@ BOOST_AUTO_TEST_CASE(query_fee_rate__get_branch_fees__cancel_three_blocks__false
     BOOST_CHECK(rates_sets.empty());
 }
 
+// get_fee_histogram
+// get_branch_fee_histograms
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__get_fee_histogram__genesis__empty)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    fee_histogram out{};
+    BOOST_CHECK(query.get_fee_histogram(out, 0));
+    BOOST_CHECK_EQUAL(out.fee, 0u);
+    BOOST_CHECK_EQUAL(out.bytes, 0u);
+    BOOST_CHECK_EQUAL(out.count, 0u);
+    BOOST_CHECK(!query.get_fee_histogram(out, 1));
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__get_branch_fee_histograms__genesis__true_one)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    fee_histograms out{};
+    BOOST_CHECK(query.get_branch_fee_histograms(out, 0, 0));
+    BOOST_CHECK(out.empty());
+    BOOST_CHECK(query.get_branch_fee_histograms(out, 0, 1));
+    BOOST_CHECK_EQUAL(out.size(), 1u);
+    BOOST_CHECK_EQUAL(out.front().count, 0u);
+    BOOST_CHECK(!query.get_branch_fee_histograms(out, 0, 2));
+    BOOST_CHECK(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__get_branch_fee_histograms__disabled__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_bk_buckets = 0;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(!query.fee_enabled());
+
+    fee_histograms out{};
+    BOOST_CHECK(!query.get_branch_fee_histograms(out, 0, 1));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
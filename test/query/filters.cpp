@@ -22,4 +22,150 @@
 
 BOOST_FIXTURE_TEST_SUITE(query_filters_tests, test::directory_setup_fixture)
 
+class filters_accessor
+  : public test::query_accessor
+{
+public:
+    using base = test::query_accessor;
+    using base::base;
+    using base::get_first_unfiltered;
+};
+
+BOOST_AUTO_TEST_CASE(query_filters__backfill_filters__unfiltered_confirmed__filtered)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    filters_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block3, context{ 0, 3, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block1_hash), false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block2_hash), false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block3_hash), false));
+
+    // Genesis is filtered by initialize.
+    BOOST_REQUIRE_EQUAL(query.get_first_unfiltered(), 1u);
+
+    std::atomic_bool cancel{};
+    BOOST_REQUIRE_EQUAL(query.backfill_filters(cancel, 2), error::success);
+    BOOST_REQUIRE_EQUAL(query.get_first_unfiltered(), 4u);
+
+    // Backfilled heads are chained as by set_filter_body/set_filter_head.
+    filter body{};
+    hash_digest previous{};
+    hash_digest hash{};
+    hash_digest head{};
+    const auto link = query.to_header(test::block1_hash);
+    BOOST_REQUIRE(query.get_filter_head(previous, query.to_header(test::genesis.hash())));
+    BOOST_REQUIRE(system::neutrino::compute_filter(body, test::block1));
+    BOOST_REQUIRE(query.get_filter_head(head, link));
+    BOOST_REQUIRE_EQUAL(head, system::neutrino::compute_header(hash, previous, body));
+
+    // Resumes (no-op) when fully filtered.
+    BOOST_REQUIRE_EQUAL(query.backfill_filters(cancel), error::success);
+    BOOST_REQUIRE_EQUAL(query.get_first_unfiltered(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(query_filters__backfill_filters__canceled__resumable)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    filters_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block1_hash), false));
+
+    std::atomic_bool canceled{ true };
+    BOOST_REQUIRE_EQUAL(query.backfill_filters(canceled), error::canceled);
+    BOOST_REQUIRE_EQUAL(query.get_first_unfiltered(), 1u);
+
+    std::atomic_bool cancel{};
+    BOOST_REQUIRE_EQUAL(query.backfill_filters(cancel), error::success);
+    BOOST_REQUIRE_EQUAL(query.get_first_unfiltered(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(query_filters__get_confirmed_filter_hashes__range__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    filters_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block3, context{ 0, 3, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block1_hash), false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block2_hash), false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block3_hash), false));
+
+    std::atomic_bool cancel{};
+    BOOST_REQUIRE_EQUAL(query.backfill_filters(cancel), error::success);
+
+    hashes expected{};
+    hash_digest expected_previous{};
+    BOOST_REQUIRE(query.get_filter_hashes(expected, expected_previous, query.to_header(test::block3_hash), 3));
+
+    hashes out{};
+    hash_digest previous{};
+    BOOST_REQUIRE(query.get_confirmed_filter_hashes(out, previous, 1, 3));
+    BOOST_REQUIRE(out == expected);
+    BOOST_REQUIRE_EQUAL(previous, expected_previous);
+
+    data_chunk wire{};
+    BOOST_REQUIRE(query.get_wire_filter_hashes(wire, previous, 1, 3));
+    BOOST_REQUIRE_EQUAL(wire.size(), add1(3u * system::hash_size));
+    BOOST_REQUIRE_EQUAL(wire.front(), 3u);
+    BOOST_REQUIRE(std::equal(expected.front().begin(), expected.front().end(), std::next(wire.begin())));
+
+    // Genesis previous is null.
+    BOOST_REQUIRE(query.get_confirmed_filter_hashes(out, previous, 0, 1));
+    BOOST_REQUIRE_EQUAL(previous, system::null_hash);
+
+    // Beyond top fails.
+    BOOST_REQUIRE(!query.get_confirmed_filter_hashes(out, previous, 1, 4));
+}
+
+BOOST_AUTO_TEST_CASE(query_filters__get_confirmed_filter_heads__interval__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    filters_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block3, context{ 0, 3, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block1_hash), false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block2_hash), false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block3_hash), false));
+
+    std::atomic_bool cancel{};
+    BOOST_REQUIRE_EQUAL(query.backfill_filters(cancel), error::success);
+
+    hashes expected{};
+    BOOST_REQUIRE(query.get_filter_heads(expected, 3, 1));
+    BOOST_REQUIRE_EQUAL(expected.size(), 3u);
+
+    hashes out{};
+    BOOST_REQUIRE(query.get_confirmed_filter_heads(out, 1, 3));
+    BOOST_REQUIRE(out == expected);
+
+    BOOST_REQUIRE(query.get_confirmed_filter_heads(out, 1, 2, 2));
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out[0], expected[0]);
+    BOOST_REQUIRE_EQUAL(out[1], expected[2]);
+
+    data_chunk wire{};
+    BOOST_REQUIRE(query.get_wire_filter_heads(wire, 1, 2, 2));
+    BOOST_REQUIRE_EQUAL(wire.size(), add1(2u * system::hash_size));
+    BOOST_REQUIRE_EQUAL(wire.front(), 2u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -311,4 +311,85 @@ BOOST_AUTO_TEST_CASE(query_height__get_confirmed_headers__under_top__full_count)
     BOOST_REQUIRE_EQUAL(query.get_header_key(headers[5]), test::block7_hash);
 }
 
+BOOST_AUTO_TEST_CASE(query_height__push_candidate_range__empty__true_unchanged)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.push_candidate(header_links{}));
+    BOOST_REQUIRE(query.push_confirmed(header_links{}, true));
+    BOOST_REQUIRE(query.pop_candidate(0));
+    BOOST_REQUIRE(query.pop_confirmed(0));
+    BOOST_REQUIRE_EQUAL(query.get_top_candidate(), 0u);
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(query_height__push_candidate_range__terminal__false_unchanged)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.push_candidate(header_links{ 0, header_link::terminal }));
+    BOOST_REQUIRE_EQUAL(query.get_top_candidate(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(query_height__push_pop_candidate_range__three__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, test::context, false, false));
+    BOOST_REQUIRE(query.set(test::block2, test::context, false, false));
+    BOOST_REQUIRE(query.set(test::block3, test::context, false, false));
+    BOOST_REQUIRE(query.push_candidate(header_links{ 1, 2, 3 }));
+    BOOST_REQUIRE_EQUAL(query.get_top_candidate(), 3u);
+    BOOST_REQUIRE_EQUAL(query.to_candidate(1), 1u);
+    BOOST_REQUIRE_EQUAL(query.to_candidate(2), 2u);
+    BOOST_REQUIRE_EQUAL(query.to_candidate(3), 3u);
+
+    // Genesis is never popped.
+    BOOST_REQUIRE(!query.pop_candidate(4));
+    BOOST_REQUIRE_EQUAL(query.get_top_candidate(), 3u);
+
+    BOOST_REQUIRE(query.pop_candidate(2));
+    BOOST_REQUIRE_EQUAL(query.get_top_candidate(), 1u);
+    BOOST_REQUIRE_EQUAL(query.to_candidate(1), 1u);
+    BOOST_REQUIRE(query.to_candidate(2).is_terminal());
+}
+
+BOOST_AUTO_TEST_CASE(query_height__push_pop_confirmed_range__strong__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, test::context, false, false));
+    BOOST_REQUIRE(query.set(test::block2, test::context, false, false));
+    BOOST_REQUIRE(query.set(test::block3, test::context, false, false));
+    BOOST_REQUIRE(query.push_confirmed(header_links{ 1, 2, 3 }, true));
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), 3u);
+    BOOST_REQUIRE_EQUAL(query.to_confirmed(3), 3u);
+    BOOST_REQUIRE(query.is_strong_block(1));
+    BOOST_REQUIRE(query.is_strong_block(2));
+    BOOST_REQUIRE(query.is_strong_block(3));
+
+    BOOST_REQUIRE(query.pop_confirmed(2));
+    BOOST_REQUIRE_EQUAL(query.get_top_confirmed(), 1u);
+    BOOST_REQUIRE(query.is_strong_block(1));
+    BOOST_REQUIRE(!query.is_strong_block(2));
+    BOOST_REQUIRE(!query.is_strong_block(3));
+    BOOST_REQUIRE(query.to_confirmed(2).is_terminal());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -31,6 +31,7 @@ public:
     using base::get_fork;
     using base::get_blocks;
     using base::get_headers;
+    using base::get_wire_headers;
     using base::get_ancestry;
     using base::get_locator_span;
     using base::get_locator_start;
@@ -201,6 +202,49 @@ BOOST_AUTO_TEST_CASE(query_locator__get_headers__reorg_terminal__returns_empty)
     BOOST_REQUIRE_EQUAL(headers[0]->hash(), test::block1_hash);
 }
 
+// get_wire_headers
+
+BOOST_AUTO_TEST_CASE(query_locator__get_wire_headers__mid_chain_locator__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    query_access query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block3, context{ 0, 3, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(1, false));
+    BOOST_REQUIRE(query.push_confirmed(2, false));
+    BOOST_REQUIRE(query.push_confirmed(3, false));
+
+    const hashes locator{ test::block1_hash, test::block0_hash };
+    const auto wire = query.get_wire_headers(locator, system::null_hash, 10);
+    const auto expected = system::splice(
+        test::block2.header().to_data(),
+        test::block3.header().to_data());
+    BOOST_REQUIRE_EQUAL(wire, expected);
+}
+
+BOOST_AUTO_TEST_CASE(query_locator__get_wire_headers__empty_locator__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    query_access query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(1, false));
+
+    const auto wire = query.get_wire_headers({}, system::null_hash, 10);
+    BOOST_REQUIRE_EQUAL(wire, test::block1.header().to_data());
+
+    // Span is limited by request limit.
+    BOOST_REQUIRE(query.get_wire_headers({}, system::null_hash, 0).empty());
+}
+
 // get_blocks
 
 BOOST_AUTO_TEST_CASE(query_locator__get_blocks__empty_locator__confirmed_headers)
@@ -49,6 +49,8 @@ public:
     using base::get_merkle_proof;
     using base::get_merkle_subroots;
     using base::get_merkle_root_and_proof;
+    using base::is_subroot_cached;
+    using base::merkle_tree_size;
 };
 
 // merkle_branch
@@ -921,6 +923,247 @@ BOOST_AUTO_TEST_CASE(query_merkle__get_merkle_root_and_proof__waypoint_beyond_to
     BOOST_CHECK_EQUAL(query.get_merkle_root(100), system::null_hash);
 }
 
+// subroot cache
+
+BOOST_AUTO_TEST_CASE(query_merkle__subroot__depth_1__cached_equals_linear)
+{
+    settings settings{};
+    settings.interval_depth = 1;
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    merkle_accessor query{ store };
+    BOOST_CHECK_EQUAL(store.create(test::events_handler), error::success);
+    BOOST_CHECK(setup_eight_block_store(query));
+
+    // Four complete intervals (0-7) produce seven nodes.
+    BOOST_CHECK_EQUAL(query.subroot_records(), 7u);
+
+    for (size_t waypoint = 0; waypoint <= 8; ++waypoint)
+    {
+        BOOST_CHECK(query.is_subroot_cached(waypoint));
+
+        hashes roots{};
+        BOOST_CHECK_EQUAL(query.get_merkle_subroots(roots, waypoint), error::success);
+        const auto expected_root = system::merkle_root(hashes{ roots });
+        BOOST_CHECK_EQUAL(query.get_merkle_root(waypoint), expected_root);
+
+        for (size_t target = 0; target <= waypoint; ++target)
+        {
+            hashes expected{};
+            BOOST_CHECK(!query.get_merkle_proof(expected, roots, target, waypoint));
+
+            hashes proof{};
+            hash_digest root{};
+            BOOST_CHECK(!query.get_merkle_root_and_proof(root, proof, target, waypoint));
+            BOOST_CHECK_EQUAL(root, expected_root);
+            BOOST_CHECK(proof == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(query_merkle__subroot__depth_1_partial_last_interval__computed)
+{
+    settings settings{};
+    settings.interval_depth = 1;
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    merkle_accessor query{ store };
+    BOOST_CHECK_EQUAL(store.create(test::events_handler), error::success);
+    BOOST_CHECK(setup_eight_block_store(query));
+
+    // Last interval (4) is partial at waypoint 4, while its cached node (4-5)
+    // exists as a later interval is complete.
+    BOOST_CHECK(query.is_subroot_cached(4));
+    const auto expected_root = system::merkle_root(
+    {
+        test::block0_hash, test::block1_hash, test::block2_hash,
+        test::block3_hash, test::block4_hash
+    });
+    BOOST_CHECK_EQUAL(query.get_merkle_root(4), expected_root);
+
+    hashes roots{};
+    BOOST_CHECK_EQUAL(query.get_merkle_subroots(roots, 4), error::success);
+    BOOST_CHECK_EQUAL(roots.size(), 3u);
+
+    for (size_t target = 0; target <= 4; ++target)
+    {
+        hashes expected{};
+        BOOST_CHECK(!query.get_merkle_proof(expected, roots, target, 4));
+
+        hashes proof{};
+        hash_digest root{};
+        BOOST_CHECK(!query.get_merkle_root_and_proof(root, proof, target, 4));
+        BOOST_CHECK_EQUAL(root, expected_root);
+        BOOST_CHECK(proof == expected);
+    }
+
+    // Waypoint zero is a single (partial) interval of the genesis block.
+    BOOST_CHECK_EQUAL(query.get_merkle_root(0), test::block0_hash);
+}
+
+BOOST_AUTO_TEST_CASE(query_merkle__subroot__depth_0_pop_confirmed__truncated)
+{
+    settings settings{};
+    settings.interval_depth = 0;
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    merkle_accessor query{ store };
+    BOOST_CHECK_EQUAL(store.create(test::events_handler), error::success);
+    BOOST_CHECK(setup_eight_block_store(query));
+
+    // Nine complete intervals (0-8) produce sixteen nodes.
+    BOOST_CHECK_EQUAL(query.subroot_records(), 16u);
+    BOOST_CHECK_EQUAL(query.get_merkle_root(8), test::root08);
+
+    BOOST_CHECK(query.pop_confirmed());
+    BOOST_CHECK_EQUAL(query.subroot_records(), 15u);
+
+    hashes proof{};
+    hash_digest root{};
+    BOOST_CHECK(!query.get_merkle_root_and_proof(root, proof, 5, 7));
+    BOOST_CHECK_EQUAL(root, system::merkle_root(
+    {
+        test::block0_hash, test::block1_hash, test::block2_hash,
+        test::block3_hash, test::block4_hash, test::block5_hash,
+        test::block6_hash, test::block7_hash
+    }));
+
+    // Repush restores the popped node.
+    BOOST_CHECK(query.push_confirmed(query.to_header(test::block8_hash), false));
+    BOOST_CHECK_EQUAL(query.subroot_records(), 16u);
+    BOOST_CHECK_EQUAL(query.get_merkle_root(8), test::root08);
+}
+
+BOOST_AUTO_TEST_CASE(query_merkle__rebuild_subroot__truncated__restored)
+{
+    settings settings{};
+    settings.interval_depth = 1;
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    merkle_accessor query{ store };
+    BOOST_CHECK_EQUAL(store.create(test::events_handler), error::success);
+    BOOST_CHECK(setup_eight_block_store(query));
+    BOOST_CHECK_EQUAL(query.subroot_records(), 7u);
+    const auto expected = query.get_merkle_root(8);
+
+    // Simulate a store confirmed before the cache existed (linear fallback).
+    BOOST_CHECK(store.subroot.truncate(0u));
+    BOOST_CHECK(!query.is_subroot_cached(8));
+    BOOST_CHECK_EQUAL(query.get_merkle_root(8), expected);
+
+    const std::atomic_bool cancel{};
+    BOOST_CHECK_EQUAL(query.rebuild_subroot(cancel), error::success);
+    BOOST_CHECK_EQUAL(query.subroot_records(), 7u);
+    BOOST_CHECK(query.is_subroot_cached(8));
+    BOOST_CHECK_EQUAL(query.get_merkle_root(8), expected);
+
+    // A synchronized cache is retained.
+    BOOST_CHECK_EQUAL(query.rebuild_subroot(cancel), error::success);
+    BOOST_CHECK_EQUAL(query.subroot_records(), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(query_merkle__rebuild_subroot__canceled__canceled)
+{
+    settings settings{};
+    settings.interval_depth = 1;
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    merkle_accessor query{ store };
+    BOOST_CHECK_EQUAL(store.create(test::events_handler), error::success);
+    BOOST_CHECK(setup_eight_block_store(query));
+    BOOST_CHECK(store.subroot.truncate(0u));
+
+    const std::atomic_bool cancel{ true };
+    BOOST_CHECK_EQUAL(query.rebuild_subroot(cancel), error::canceled);
+    BOOST_CHECK(!query.is_subroot_cached(8));
+}
+
+// get_tx_merkle_branch
+
+BOOST_AUTO_TEST_CASE(query_merkle__merkle_tree_size__various__expected)
+{
+    BOOST_CHECK_EQUAL(merkle_accessor::merkle_tree_size(0), 0u);
+    BOOST_CHECK_EQUAL(merkle_accessor::merkle_tree_size(1), 1u);
+    BOOST_CHECK_EQUAL(merkle_accessor::merkle_tree_size(2), 3u);
+    BOOST_CHECK_EQUAL(merkle_accessor::merkle_tree_size(3), 6u);
+    BOOST_CHECK_EQUAL(merkle_accessor::merkle_tree_size(4), 7u);
+    BOOST_CHECK_EQUAL(merkle_accessor::merkle_tree_size(5), 11u);
+}
+
+BOOST_AUTO_TEST_CASE(query_merkle__get_tx_merkle_branch__unconfirmed__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    merkle_accessor query{ store };
+    BOOST_CHECK_EQUAL(store.create(test::events_handler), error::success);
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, test::context, false, false));
+
+    hashes branch{};
+    size_t position{};
+    BOOST_CHECK(!query.get_tx_merkle_branch(branch, position, 1));
+    BOOST_CHECK(!query.get_tx_merkle_branch(branch, position, 42));
+}
+
+BOOST_AUTO_TEST_CASE(query_merkle__get_tx_merkle_branch__genesis__empty)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    merkle_accessor query{ store };
+    BOOST_CHECK_EQUAL(store.create(test::events_handler), error::success);
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    hashes branch{ system::null_hash };
+    size_t position{ 42 };
+    BOOST_CHECK(query.get_tx_merkle_branch(branch, position, 0));
+    BOOST_CHECK(branch.empty());
+    BOOST_CHECK_EQUAL(position, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(query_merkle__get_tx_merkle_branch__cached__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.merkle_cache_limit = 1024 * 1024;
+    test::chunk_store store{ settings };
+    merkle_accessor query{ store };
+    BOOST_CHECK_EQUAL(store.create(test::events_handler), error::success);
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, context{ 0, 1, 0 }, false, true));
+    BOOST_CHECK(query.set(test::block2a, context{ 0, 2, 0 }, false, true));
+    BOOST_CHECK(query.push_confirmed(query.to_header(test::block1a.hash()), false));
+    BOOST_CHECK(query.push_confirmed(query.to_header(test::block2a.hash()), false));
+
+    const auto& txs = *test::block2a.transactions_ptr();
+    const auto first = txs.at(0)->hash(false);
+    const auto second = txs.at(1)->hash(false);
+
+    // Both txs of block2a share one cached tree.
+    hashes branch{};
+    size_t position{};
+    BOOST_CHECK(query.get_tx_merkle_branch(branch, position, 2));
+    BOOST_CHECK_EQUAL(position, 0u);
+    BOOST_CHECK_EQUAL(branch, hashes{ second });
+    BOOST_CHECK(query.get_tx_merkle_branch(branch, position, 3));
+    BOOST_CHECK_EQUAL(position, 1u);
+    BOOST_CHECK_EQUAL(branch, hashes{ first });
+
+    auto metrics = query.get_merkle_cache_metrics();
+    BOOST_CHECK_EQUAL(metrics.hits, 1u);
+    BOOST_CHECK_EQUAL(metrics.misses, 1u);
+    BOOST_CHECK_EQUAL(metrics.entries, 1u);
+    BOOST_CHECK_EQUAL(metrics.bytes, 3u * system::hash_size + wire_cache::overhead());
+
+    // Pop releases the tree and the tx is no longer strong.
+    BOOST_CHECK(query.pop_confirmed());
+    metrics = query.get_merkle_cache_metrics();
+    BOOST_CHECK_EQUAL(metrics.entries, 0u);
+    BOOST_CHECK(query.set_unstrong(2));
+    BOOST_CHECK(!query.get_tx_merkle_branch(branch, position, 3));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // ==================================
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+#include "../mocks/chunk_store.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(query_pool_tests, test::directory_setup_fixture)
+
+BOOST_AUTO_TEST_CASE(query_pool__set_pooled__disabled__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.pool_buckets = 0;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.pool_enabled());
+    BOOST_REQUIRE(!query.set_pooled(test::tx4));
+    BOOST_REQUIRE(!query.is_pooled(test::tx4.hash(false)));
+    BOOST_REQUIRE(query.rotate_pool());
+}
+
+BOOST_AUTO_TEST_CASE(query_pool__set_pooled__not_archived__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.pool_enabled());
+
+    const auto tx_records = query.tx_records();
+    const auto key = test::tx4.hash(false);
+    BOOST_REQUIRE(query.set_pooled(test::tx4));
+    BOOST_REQUIRE(query.set_pooled(test::tx4));
+    BOOST_REQUIRE(query.is_pooled(key));
+    BOOST_REQUIRE(!query.is_tx(key));
+    BOOST_REQUIRE_EQUAL(query.tx_records(), tx_records);
+
+    const auto tx = query.get_pooled_transaction(key);
+    BOOST_REQUIRE(tx);
+    BOOST_REQUIRE(*tx == test::tx4);
+    BOOST_REQUIRE(!query.get_pooled_transaction(test::tx5.hash(false)));
+}
+
+BOOST_AUTO_TEST_CASE(query_pool__rotate_pool__two_rotations__evicted)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    const auto key4 = test::tx4.hash(false);
+    const auto key5 = test::tx5.hash(false);
+    BOOST_REQUIRE(query.set_pooled(test::tx4));
+    BOOST_REQUIRE(query.rotate_pool());
+    BOOST_REQUIRE(query.is_pooled(key4));
+
+    BOOST_REQUIRE(query.set_pooled(test::tx5));
+    BOOST_REQUIRE(query.rotate_pool());
+    BOOST_REQUIRE(!query.is_pooled(key4));
+    BOOST_REQUIRE(query.is_pooled(key5));
+
+    BOOST_REQUIRE(query.rotate_pool());
+    BOOST_REQUIRE(!query.is_pooled(key5));
+    BOOST_REQUIRE(is_zero(query.pool0_body_size()));
+    BOOST_REQUIRE(is_zero(query.pool1_body_size()));
+}
+
+BOOST_AUTO_TEST_CASE(query_pool__set_pooled__limit__rotates)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.pool_limit = 1;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    // Each write exceeds the limit, so each subsequent write rotates.
+    BOOST_REQUIRE(query.set_pooled(test::tx4));
+    BOOST_REQUIRE(query.set_pooled(test::tx5));
+    BOOST_REQUIRE(query.is_pooled(test::tx4.hash(false)));
+    BOOST_REQUIRE(query.set_pooled(*test::block1a.transactions_ptr()->front()));
+    BOOST_REQUIRE(!query.is_pooled(test::tx4.hash(false)));
+    BOOST_REQUIRE(query.is_pooled(test::tx5.hash(false)));
+}
+
+BOOST_AUTO_TEST_CASE(query_pool__rotate_pool__reopened__generation_retained)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    {
+        test::query_accessor query{ store };
+        BOOST_REQUIRE(!store.create(test::events_handler));
+        BOOST_REQUIRE(query.initialize(test::genesis));
+        BOOST_REQUIRE(query.set_pooled(test::tx4));
+        BOOST_REQUIRE(query.rotate_pool());
+        BOOST_REQUIRE(query.set_pooled(test::tx5));
+        BOOST_REQUIRE(!store.close(test::events_handler));
+    }
+
+    // A new query resumes the generation, so rotation empties the older.
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.open(test::events_handler));
+    BOOST_REQUIRE_EQUAL(store.pool_generation(), 1u);
+    BOOST_REQUIRE(query.rotate_pool());
+    BOOST_REQUIRE(!query.is_pooled(test::tx4.hash(false)));
+    BOOST_REQUIRE(query.is_pooled(test::tx5.hash(false)));
+    BOOST_REQUIRE(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_pool__set_pooled__short_ids__pooled_reference)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.short_id_limit = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set_pooled(test::tx4));
+    BOOST_REQUIRE(query.set_pooled(test::tx4));
+
+    short_ids::key key{};
+    BOOST_REQUIRE(query.get_short_id_key(key, 0, 42));
+    BOOST_REQUIRE_EQUAL(query.get_short_ids(key)->size(), 1u);
+
+    // Pooled txs are not archived, so have no tx link.
+    const auto id4 = short_ids::to_id(key, test::tx4.hash(true));
+    BOOST_REQUIRE(query.to_short_id_txs(key, id4).empty());
+
+    const auto pooled = query.get_short_id_pooled(key, id4);
+    BOOST_REQUIRE_EQUAL(pooled.size(), 1u);
+    BOOST_REQUIRE(*pooled.front() == test::tx4);
+
+    // The reference is not resolved once its generation is emptied.
+    BOOST_REQUIRE(query.rotate_pool());
+    BOOST_REQUIRE(query.rotate_pool());
+    BOOST_REQUIRE(query.get_short_id_pooled(key, id4).empty());
+}
+
+BOOST_AUTO_TEST_CASE(query_pool__get_short_id_pooled__reused_link__current_only)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.short_id_limit = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set_pooled(test::tx4));
+
+    // The reference remains resolvable in the prior generation.
+    short_ids::key key{};
+    BOOST_REQUIRE(query.get_short_id_key(key, 0, 42));
+    const auto id4 = short_ids::to_id(key, test::tx4.hash(true));
+    BOOST_REQUIRE(query.rotate_pool());
+    BOOST_REQUIRE_EQUAL(query.get_short_id_pooled(key, id4).size(), 1u);
+
+    // The same pool and link are reused two generations later.
+    BOOST_REQUIRE(query.rotate_pool());
+    BOOST_REQUIRE(query.set_pooled(test::tx4));
+    BOOST_REQUIRE_EQUAL(query.get_short_ids(key)->size(), 2u);
+
+    // Only the current generation reference is resolved.
+    const auto pooled = query.get_short_id_pooled(key, id4);
+    BOOST_REQUIRE_EQUAL(pooled.size(), 1u);
+    BOOST_REQUIRE(*pooled.front() == test::tx4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -22,6 +22,40 @@
 
 BOOST_FIXTURE_TEST_SUITE(query_properties_tx_tests, test::directory_setup_fixture)
 
+BOOST_AUTO_TEST_CASE(query_properties_tx__is_tx__tx_bloom__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.tx_bloom_limit = 1024;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(store.tx_bloom.loaded());
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{}, false, false));
+
+    const auto genesis = test::genesis.transactions_ptr()->front()->hash(false);
+    const auto block1 = test::block1.transactions_ptr()->front()->hash(false);
+    const auto block2 = test::block2.transactions_ptr()->front()->hash(false);
+    BOOST_REQUIRE(query.is_tx(genesis));
+    BOOST_REQUIRE(query.is_tx(block1));
+    BOOST_REQUIRE(!query.is_tx(block2));
+    BOOST_REQUIRE(query.to_tx(block1) == 1u);
+    BOOST_REQUIRE(query.to_tx(block2).is_terminal());
+    BOOST_REQUIRE(!store.tx_bloom.contains(block2));
+
+    // Reopen populates the filter from the table.
+    BOOST_REQUIRE(!store.close(test::events_handler));
+    BOOST_REQUIRE(!store.tx_bloom.loaded());
+    BOOST_REQUIRE(!store.open(test::events_handler));
+    BOOST_REQUIRE(store.tx_bloom.loaded());
+    BOOST_REQUIRE(store.tx_bloom.contains(genesis));
+    BOOST_REQUIRE(store.tx_bloom.contains(block1));
+    BOOST_REQUIRE(query.is_tx(block1));
+    BOOST_REQUIRE(!query.is_tx(block2));
+    BOOST_REQUIRE(!store.close(test::events_handler));
+}
+
 BOOST_AUTO_TEST_CASE(query_properties_tx__get_tx_state__invalid_link__unvalidated)
 {
     settings settings{};
@@ -135,4 +169,106 @@ BOOST_AUTO_TEST_CASE(query_properties_tx__get_tx_state__connected_in_context__tx
     BOOST_REQUIRE_EQUAL(sigops, 0u);
 }
 
+BOOST_AUTO_TEST_CASE(query_properties_tx__rotate_validated_tx__no_window__unchanged)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    constexpr context ctx{ 0, 0, 0 };
+    BOOST_REQUIRE(query.set_tx_connected(0, ctx, 0, 0));
+    const auto size = query.validated_tx_body_size();
+    BOOST_REQUIRE(query.rotate_validated_tx());
+    BOOST_REQUIRE_EQUAL(query.validated_tx_body_size(), size);
+    BOOST_REQUIRE_EQUAL(query.validated_tx1_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(0, ctx), error::tx_connected);
+}
+
+BOOST_AUTO_TEST_CASE(query_properties_tx__rotate_validated_tx__window__retains_window)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.validated_tx_window = 1;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{}, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{}, false, false));
+    BOOST_REQUIRE(query.set(test::block3, context{}, false, false));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block1.hash())));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block2.hash())));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block3.hash())));
+
+    uint64_t fee{};
+    size_t sigops{};
+    constexpr context top{ 0, 3, 0 };
+    BOOST_REQUIRE(query.set_tx_connected(1, { 0, 1, 0 }, 11, 12));
+    BOOST_REQUIRE(query.set_tx_connected(2, { 0, 2, 0 }, 13, 14));
+    BOOST_REQUIRE(query.set_tx_disconnected(3, { 0, 3, 0 }));
+
+    // States below the top candidate (3) less the window (1) are dropped.
+    BOOST_REQUIRE(query.rotate_validated_tx());
+    BOOST_REQUIRE(is_nonzero(query.validated_tx_body_size()));
+    BOOST_REQUIRE(is_nonzero(query.validated_tx1_body_size()));
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(2, top), error::tx_connected);
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(3, top), error::tx_disconnected);
+
+    // The former current generation is emptied by the next rotation.
+    BOOST_REQUIRE(query.rotate_validated_tx());
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(1, top), error::unvalidated);
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(fee, sigops, 2, top), error::tx_connected);
+    BOOST_REQUIRE_EQUAL(fee, 13u);
+    BOOST_REQUIRE_EQUAL(sigops, 14u);
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(3, top), error::tx_disconnected);
+
+    // Writes go to the current generation.
+    const auto size = query.validated_tx1_body_size();
+    BOOST_REQUIRE(query.set_tx_connected(1, top, 15, 16));
+    BOOST_REQUIRE_EQUAL(query.validated_tx1_body_size(), size);
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(1, top), error::tx_connected);
+}
+
+BOOST_AUTO_TEST_CASE(query_properties_tx__rotate_validated_tx__reopened__generation_retained)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.validated_tx_window = 1;
+    test::chunk_store store{ settings };
+    constexpr context top{ 0, 3, 0 };
+    {
+        test::query_accessor query{ store };
+        BOOST_REQUIRE(!store.create(test::events_handler));
+        BOOST_REQUIRE(query.initialize(test::genesis));
+        BOOST_REQUIRE(query.set(test::block1, context{}, false, false));
+        BOOST_REQUIRE(query.set(test::block2, context{}, false, false));
+        BOOST_REQUIRE(query.set(test::block3, context{}, false, false));
+        BOOST_REQUIRE(query.push_candidate(query.to_header(test::block1.hash())));
+        BOOST_REQUIRE(query.push_candidate(query.to_header(test::block2.hash())));
+        BOOST_REQUIRE(query.push_candidate(query.to_header(test::block3.hash())));
+        BOOST_REQUIRE(query.set_tx_connected(1, { 0, 1, 0 }, 11, 12));
+        BOOST_REQUIRE(query.rotate_validated_tx());
+        BOOST_REQUIRE(query.set_tx_connected(3, top, 13, 14));
+        BOOST_REQUIRE(!store.close(test::events_handler));
+    }
+
+    // A new query resumes the generation, writing to the current table.
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.open(test::events_handler));
+    BOOST_REQUIRE_EQUAL(store.validated_tx_generation(), 1u);
+    const auto size = query.validated_tx1_body_size();
+    BOOST_REQUIRE(query.set_tx_connected(2, top, 15, 16));
+    BOOST_REQUIRE_GT(query.validated_tx1_body_size(), size);
+
+    // Rotation empties the older table, retaining states of the current.
+    BOOST_REQUIRE(query.rotate_validated_tx());
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(1, top), error::unvalidated);
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(2, top), error::tx_connected);
+    BOOST_REQUIRE_EQUAL(query.get_tx_state(3, top), error::tx_connected);
+    BOOST_REQUIRE(!store.close(test::events_handler));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+#include "../mocks/chunk_store.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(query_spent_tests, test::directory_setup_fixture)
+
+BOOST_AUTO_TEST_CASE(query_spent__to_outs__genesis__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE_EQUAL(query.to_outs(query.to_output(0, 0)), 0u);
+    BOOST_REQUIRE(query.to_outs(query.to_output(0, 1)).is_terminal());
+    BOOST_REQUIRE(query.to_outs(query.to_output(1, 0)).is_terminal());
+}
+
+BOOST_AUTO_TEST_CASE(query_spent__to_outs__tx_index__matches_output)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+
+    // Bisection over ascending output fks matches the indexed ordinal.
+    const auto outputs = system::possible_narrow_cast<uint32_t>(
+        test::block1a.transactions_ptr()->front()->outputs());
+    for (uint32_t index{}; index < outputs; ++index)
+    {
+        const auto outs = query.to_outs(1, index);
+        BOOST_REQUIRE(!outs.is_terminal());
+        BOOST_REQUIRE_EQUAL(query.to_outs(query.to_output(1, index)), outs);
+        BOOST_REQUIRE_EQUAL(outs, add1(index));
+    }
+
+    BOOST_REQUIRE(query.to_outs(1, outputs).is_terminal());
+    BOOST_REQUIRE(query.to_outs(2, 0).is_terminal());
+}
+
+BOOST_AUTO_TEST_CASE(query_spent__is_spent_bit__genesis__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.is_spent_bit(0));
+    BOOST_REQUIRE(!query.is_spent_bit(outs_link{}));
+    BOOST_REQUIRE_EQUAL(query.spent_records(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(query_spent__is_spent_bit__push_pop_confirmed__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2a, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.set_strong(1));
+    BOOST_REQUIRE(query.set_strong(2));
+
+    const auto out10 = query.to_outs(query.to_output(1, 0));
+    const auto out11 = query.to_outs(query.to_output(1, 1));
+    BOOST_REQUIRE(!out10.is_terminal());
+    BOOST_REQUIRE(!out11.is_terminal());
+
+    BOOST_REQUIRE(query.push_confirmed(1, false));
+    BOOST_REQUIRE(!query.is_spent_bit(out10));
+    BOOST_REQUIRE(!query.is_spent_bit(out11));
+
+    // block2a spends both outputs of block1a.
+    BOOST_REQUIRE(query.push_confirmed(2, false));
+    BOOST_REQUIRE(query.is_spent_bit(out10));
+    BOOST_REQUIRE(query.is_spent_bit(out11));
+    BOOST_REQUIRE(!query.is_spent_bit(0));
+    BOOST_REQUIRE(query.is_confirmed_spent(query.to_output(1, 0)));
+    BOOST_REQUIRE(query.is_confirmed_spent(query.to_output(1, 1)));
+    BOOST_REQUIRE(query.is_confirmed_spent(1, 0));
+    BOOST_REQUIRE(query.is_confirmed_spent(1, 1));
+
+    BOOST_REQUIRE(query.pop_confirmed());
+    BOOST_REQUIRE(!query.is_spent_bit(out10));
+    BOOST_REQUIRE(!query.is_spent_bit(out11));
+    BOOST_REQUIRE(!query.is_confirmed_spent(query.to_output(1, 0)));
+    BOOST_REQUIRE(!query.is_confirmed_spent(query.to_output(1, 1)));
+}
+
+BOOST_AUTO_TEST_CASE(query_spent__rebuild_spent__cleared__restored)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+
+    const auto out10 = query.to_outs(query.to_output(1, 0));
+    const auto out11 = query.to_outs(query.to_output(1, 1));
+    BOOST_REQUIRE(query.is_spent_bit(out10));
+    BOOST_REQUIRE(query.is_spent_bit(out11));
+
+    // Simulate a store populated before bitmap maintenance.
+    BOOST_REQUIRE(store.spent.truncate(0u));
+    BOOST_REQUIRE(store.spent.set_complete(false));
+    BOOST_REQUIRE(!query.is_spent_bit(out10));
+    BOOST_REQUIRE(!query.is_spent_bit(out11));
+
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(!query.rebuild_spent(cancel));
+    BOOST_REQUIRE(store.spent.is_complete());
+    BOOST_REQUIRE(query.is_spent_bit(out10));
+    BOOST_REQUIRE(query.is_spent_bit(out11));
+    BOOST_REQUIRE(!query.is_spent_bit(0));
+    BOOST_REQUIRE(query.spent_records() >= add1(table::spent::to_byte(out11)));
+}
+
+BOOST_AUTO_TEST_CASE(query_spent__is_confirmed_spent__incomplete__spenders)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(store.spent.is_complete());
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+
+    // An incomplete bitmap is not trusted, spenders are resolved instead.
+    BOOST_REQUIRE(store.spent.truncate(0u));
+    BOOST_REQUIRE(store.spent.set_complete(false));
+    BOOST_REQUIRE(!query.is_spent_bit(query.to_outs(1, 0)));
+    BOOST_REQUIRE(query.is_confirmed_spent(query.to_output(1, 0)));
+    BOOST_REQUIRE(query.is_confirmed_spent(query.to_output(1, 1)));
+    BOOST_REQUIRE(query.is_confirmed_spent(1, 0));
+    BOOST_REQUIRE(!query.is_confirmed_spent(query.to_output(0, 0)));
+}
+
+BOOST_AUTO_TEST_CASE(query_spent__rebuild_spent__canceled__canceled)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+
+    const std::atomic_bool cancel{ true };
+    BOOST_REQUIRE_EQUAL(query.rebuild_spent(cancel), error::canceled);
+    BOOST_REQUIRE(!store.spent.is_complete());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
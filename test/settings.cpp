@@ -25,7 +25,16 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     database::settings configuration;
     BOOST_REQUIRE_EQUAL(configuration.turbo, false);
     BOOST_REQUIRE_EQUAL(configuration.interval_depth, 255u);
+    BOOST_REQUIRE_EQUAL(configuration.wire_cache_limit, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.merkle_cache_limit, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.tx_bloom_limit, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.short_id_limit, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.residency_limit, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.residency_lock, false);
+    BOOST_REQUIRE_EQUAL(configuration.prefault_tail, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.read_only, false);
     BOOST_REQUIRE_EQUAL(configuration.path, "bitcoin");
+    BOOST_REQUIRE(configuration.paths.empty());
 
     // Archives.
     BOOST_REQUIRE_EQUAL(configuration.header_buckets, 128u);
@@ -57,6 +66,10 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.strong_tx_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.strong_tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.strong_tx_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.spent_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.spent_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.subroot_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.subroot_rate, 50u);
 
     // Caches.
     BOOST_REQUIRE_EQUAL(configuration.duplicate_buckets, 128u);
@@ -71,6 +84,7 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.validated_tx_window, 0u);
 
     // Optionals.
     BOOST_REQUIRE_EQUAL(configuration.address_buckets, 128u);
@@ -82,6 +96,13 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.filter_tx_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.filter_tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.filter_tx_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_bk_buckets, 128u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_bk_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_bk_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.pool_buckets, 128u);
+    BOOST_REQUIRE_EQUAL(configuration.pool_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.pool_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.pool_limit, 0u);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -149,14 +149,22 @@ BOOST_AUTO_TEST_CASE(store__paths__default_configuration__expected)
     BOOST_REQUIRE_EQUAL(instance.confirmed_body_file(), "bitcoin/confirmed.data");
     BOOST_REQUIRE_EQUAL(instance.strong_tx_head_file(), "bitcoin/heads/strong_tx.head");
     BOOST_REQUIRE_EQUAL(instance.strong_tx_body_file(), "bitcoin/strong_tx.data");
+    BOOST_REQUIRE_EQUAL(instance.spent_head_file(), "bitcoin/heads/spent.head");
+    BOOST_REQUIRE_EQUAL(instance.spent_body_file(), "bitcoin/spent.data");
+    BOOST_REQUIRE_EQUAL(instance.subroot_head_file(), "bitcoin/heads/subroot.head");
+    BOOST_REQUIRE_EQUAL(instance.subroot_body_file(), "bitcoin/subroot.data");
 
     /// Caches.
     BOOST_REQUIRE_EQUAL(instance.duplicate_head_file(), "bitcoin/heads/duplicate.head");
     BOOST_REQUIRE_EQUAL(instance.duplicate_body_file(), "bitcoin/duplicate.data");
     BOOST_REQUIRE_EQUAL(instance.prevout_head_file(), "bitcoin/heads/prevout.head");
     BOOST_REQUIRE_EQUAL(instance.prevout_body_file(), "bitcoin/prevout.data");
+    BOOST_REQUIRE_EQUAL(instance.prevout1_head_file(), "bitcoin/heads/prevout1.head");
+    BOOST_REQUIRE_EQUAL(instance.prevout1_body_file(), "bitcoin/prevout1.data");
     BOOST_REQUIRE_EQUAL(instance.validated_tx_head_file(), "bitcoin/heads/validated_tx.head");
     BOOST_REQUIRE_EQUAL(instance.validated_tx_body_file(), "bitcoin/validated_tx.data");
+    BOOST_REQUIRE_EQUAL(instance.validated_tx1_head_file(), "bitcoin/heads/validated_tx1.head");
+    BOOST_REQUIRE_EQUAL(instance.validated_tx1_body_file(), "bitcoin/validated_tx1.data");
 
     BOOST_REQUIRE_EQUAL(instance.address_head_file(), "bitcoin/heads/address.head");
     BOOST_REQUIRE_EQUAL(instance.address_body_file(), "bitcoin/address.data");
@@ -164,6 +172,12 @@ BOOST_AUTO_TEST_CASE(store__paths__default_configuration__expected)
     BOOST_REQUIRE_EQUAL(instance.filter_bk_body_file(), "bitcoin/filter_bk.data");
     BOOST_REQUIRE_EQUAL(instance.filter_tx_head_file(), "bitcoin/heads/filter_tx.head");
     BOOST_REQUIRE_EQUAL(instance.filter_tx_body_file(), "bitcoin/filter_tx.data");
+    BOOST_REQUIRE_EQUAL(instance.fee_bk_head_file(), "bitcoin/heads/fee_bk.head");
+    BOOST_REQUIRE_EQUAL(instance.fee_bk_body_file(), "bitcoin/fee_bk.data");
+    BOOST_REQUIRE_EQUAL(instance.pool0_head_file(), "bitcoin/heads/pool0.head");
+    BOOST_REQUIRE_EQUAL(instance.pool0_body_file(), "bitcoin/pool0.data");
+    BOOST_REQUIRE_EQUAL(instance.pool1_head_file(), "bitcoin/heads/pool1.head");
+    BOOST_REQUIRE_EQUAL(instance.pool1_body_file(), "bitcoin/pool1.data");
 
     /// Locks.
     BOOST_REQUIRE_EQUAL(instance.flush_lock_file(), "bitcoin/flush.lock");
@@ -259,6 +273,116 @@ BOOST_AUTO_TEST_CASE(store__create__existing_body__success)
     BOOST_REQUIRE(!instance.close(events));
 }
 
+BOOST_AUTO_TEST_CASE(store__create__path_overrides__placed)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    const auto hot = configuration.path / "hot";
+    const auto cold = configuration.path / "cold";
+    configuration.paths["archive_header.head"] = hot;
+    configuration.paths["archive_input.data"] = cold;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE_EQUAL(instance.header_head_file(), hot / "archive_header.head");
+    BOOST_REQUIRE_EQUAL(instance.input_body_file(), cold / "archive_input.data");
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(test::exists(hot / "archive_header.head"));
+    BOOST_REQUIRE(test::exists(cold / "archive_input.data"));
+    BOOST_REQUIRE(!test::exists(configuration.path / "archive_input.data"));
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__advise__created__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.advise_initial());
+    BOOST_REQUIRE(!instance.advise_steady());
+    BOOST_REQUIRE(!instance.advise(table_t::input_body, advice_t::cold, 0, 4096));
+    BOOST_REQUIRE(!instance.advise(table_t::header_head, advice_t::willneed));
+    BOOST_REQUIRE(!instance.advise(table_t::store, advice_t::dontneed));
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__prefault__heads__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+
+    std::atomic<size_t> count{};
+    BOOST_REQUIRE(!instance.prefault([&](event_t event, table_t) NOEXCEPT
+    {
+        if (event == event_t::prefault_file)
+            ++count;
+    }));
+
+    BOOST_REQUIRE_EQUAL(count.load(), 25u);
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__prefault__body_tails__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.prefault_tail = 4096;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.prefault(events));
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__govern__disabled__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.govern());
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__govern__budget__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.residency_limit = 1024;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.govern());
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__govern__budget_reduced__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.residency_limit = max_uint32;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(!instance.govern());
+
+    // Heads beyond the reduced budget are unlocked (configuration is held).
+    configuration.residency_limit = 1;
+    BOOST_REQUIRE(!instance.govern());
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__report_residency__created__all_files)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(events));
+
+    size_t count{};
+    instance.report([&](size_t, table_t) NOEXCEPT { ++count; });
+    BOOST_REQUIRE_EQUAL(count, 50u);
+    BOOST_REQUIRE(!instance.close(events));
+}
+
 // open
 // ----------------------------------------------------------------------------
 
@@ -333,6 +457,39 @@ BOOST_AUTO_TEST_CASE(store__open__created__success)
     BOOST_REQUIRE(!instance.close(events));
 }
 
+BOOST_AUTO_TEST_CASE(store__open__missing_added_tables__created_rebuilt)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    query<store<map>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE(query_.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::block2a, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query_.set_strong(1));
+    BOOST_REQUIRE(query_.set_strong(2));
+    BOOST_REQUIRE(query_.push_confirmed(1, false));
+    BOOST_REQUIRE(query_.push_confirmed(2, false));
+    BOOST_REQUIRE(!instance.close(events));
+
+    // Simulate a store created before the spent and fee_bk tables.
+    BOOST_REQUIRE(test::remove(instance.spent_head_file()));
+    BOOST_REQUIRE(test::remove(instance.spent_body_file()));
+    BOOST_REQUIRE(test::remove(instance.fee_bk_head_file()));
+    BOOST_REQUIRE(test::remove(instance.fee_bk_body_file()));
+
+    // Added tables are created and the bitmap rebuilt.
+    BOOST_REQUIRE(!instance.open(events));
+    BOOST_REQUIRE(test::exists(instance.spent_head_file()));
+    BOOST_REQUIRE(test::exists(instance.fee_bk_head_file()));
+    BOOST_REQUIRE(instance.spent.is_complete());
+    BOOST_REQUIRE(query_.is_spent_bit(query_.to_outs(1, 0)));
+    BOOST_REQUIRE(query_.is_confirmed_spent(1, 0));
+    BOOST_REQUIRE_EQUAL(query_.get_top_confirmed(), 2u);
+    BOOST_REQUIRE(!instance.close(events));
+}
+
 // prune
 // ----------------------------------------------------------------------------
 // Empty store asserts so create and initialize.
@@ -349,6 +506,99 @@ BOOST_AUTO_TEST_CASE(store__prune__initialized__success)
     BOOST_REQUIRE(!instance.close(events));
 }
 
+BOOST_AUTO_TEST_CASE(store__prune__initialized__swaps_prevout_generations)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<map> instance{ configuration };
+    query<store<map>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout);
+    BOOST_REQUIRE(&instance.prior_prevout() == &instance.prevout1);
+
+    BOOST_REQUIRE(!instance.prune(events));
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout1);
+    BOOST_REQUIRE(&instance.prior_prevout() == &instance.prevout);
+
+    // Snapshot empties the retired generation, a second prune swaps back.
+    BOOST_REQUIRE(!instance.snapshot(events));
+    BOOST_REQUIRE_EQUAL(instance.prevout.count().value, 0u);
+    BOOST_REQUIRE(!instance.prune(events));
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout);
+    BOOST_REQUIRE(!instance.snapshot(events));
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__prune__snapshot_close_open_prune__generations_retained)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<map> instance{ configuration };
+    query<store<map>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+
+    // block_spend_internal_2b spends only its own coinbase (terminal prevout).
+    BOOST_REQUIRE(query_.set(test::block1b, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query_.set(test::block_spend_internal_2b, context{ 0, 101, 0 }, false, false));
+    BOOST_REQUIRE(query_.set_strong(1));
+    BOOST_REQUIRE(query_.set_strong(2));
+    BOOST_REQUIRE_EQUAL(query_.block_confirmable(2), error::integrity_get_prevouts);
+    BOOST_REQUIRE(query_.set_prevouts(2, test::block_spend_internal_2b));
+    BOOST_REQUIRE_EQUAL(query_.block_confirmable(2), error::success);
+
+    // Prevouts of the retired generation are read until it is emptied.
+    BOOST_REQUIRE(!instance.prune(events));
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout1);
+    BOOST_REQUIRE_EQUAL(query_.block_confirmable(2), error::success);
+
+    // Snapshot empties the retired generation.
+    BOOST_REQUIRE(query_.set_prevouts(2, test::block_spend_internal_2b));
+    BOOST_REQUIRE(!instance.snapshot(events));
+    BOOST_REQUIRE_EQUAL(instance.prevout.count().value, 0u);
+    BOOST_REQUIRE_NE(instance.prevout1.count().value, 0u);
+    BOOST_REQUIRE_EQUAL(query_.block_confirmable(2), error::success);
+
+    // The current generation is retained across close/open.
+    BOOST_REQUIRE(!instance.close(events));
+    BOOST_REQUIRE(!instance.open(events));
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout1);
+    BOOST_REQUIRE_EQUAL(query_.block_confirmable(2), error::success);
+
+    // The second prune retires (and snapshot empties) the former current.
+    BOOST_REQUIRE(!instance.prune(events));
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout);
+    BOOST_REQUIRE_EQUAL(query_.block_confirmable(2), error::success);
+    BOOST_REQUIRE(!instance.snapshot(events));
+    BOOST_REQUIRE_EQUAL(instance.prevout1.count().value, 0u);
+    BOOST_REQUIRE_EQUAL(query_.block_confirmable(2), error::integrity_get_prevouts);
+    BOOST_REQUIRE(!instance.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__prune__prune_without_snapshot__pending_prune)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<map> instance{ configuration };
+    query<store<map>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance.prune(events));
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout1);
+
+    // The retired generation is not swapped back until emptied.
+    BOOST_REQUIRE_EQUAL(instance.prune(events), error::pending_prune);
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout1);
+    BOOST_REQUIRE(&instance.prior_prevout() == &instance.prevout);
+
+    BOOST_REQUIRE(!instance.snapshot(events));
+    BOOST_REQUIRE(!instance.prune(events));
+    BOOST_REQUIRE(&instance.current_prevout() == &instance.prevout);
+    BOOST_REQUIRE(!instance.snapshot(events));
+    BOOST_REQUIRE(!instance.close(events));
+}
+
 // snapshot
 // ----------------------------------------------------------------------------
 
@@ -669,4 +919,73 @@ BOOST_AUTO_TEST_CASE(store__restore__snapshot__success_unlocks)
     BOOST_REQUIRE(!test::exists(instance.process_lock_file()));
 }
 
+BOOST_AUTO_TEST_CASE(store__read_only__attach_to_writer__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store writer{ configuration };
+    query<store<map>> writer_query{ writer };
+    BOOST_REQUIRE(!writer.create(events));
+    BOOST_REQUIRE(writer_query.initialize(test::genesis));
+    BOOST_REQUIRE(!writer.publish(events));
+
+    settings reader_configuration{ configuration };
+    reader_configuration.read_only = true;
+    test::map_store reader{ reader_configuration };
+    query<store<map>> reader_query{ reader };
+    BOOST_REQUIRE(!reader.open(events));
+    BOOST_REQUIRE(reader_query.is_initialized());
+    BOOST_REQUIRE_EQUAL(reader_query.get_top_candidate(), 0u);
+    BOOST_REQUIRE_EQUAL(reader_query.get_header_key(reader_query.to_candidate(0)), test::genesis.hash());
+
+    // Reader follows the writer upon publish and refresh.
+    BOOST_REQUIRE(writer_query.set(system::chain::header{}, context{}, false));
+    BOOST_REQUIRE(!writer.publish(events));
+    BOOST_REQUIRE(!reader.refresh(events));
+    BOOST_REQUIRE_EQUAL(reader.header.count(), writer.header.count());
+
+    BOOST_REQUIRE_EQUAL(reader.snapshot(events), error::read_only_store);
+    BOOST_REQUIRE_EQUAL(reader.publish(events), error::read_only_store);
+    BOOST_REQUIRE(!reader.close(events));
+    BOOST_REQUIRE(!writer.refresh(events));
+    BOOST_REQUIRE(!writer.close(events));
+}
+
+BOOST_AUTO_TEST_CASE(store__read_only__publish_refresh__generations_followed)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store writer{ configuration };
+    query<store<map>> writer_query{ writer };
+    BOOST_REQUIRE(!writer.create(events));
+    BOOST_REQUIRE(writer_query.initialize(test::genesis));
+    BOOST_REQUIRE(!writer.publish(events));
+
+    settings reader_configuration{ configuration };
+    reader_configuration.read_only = true;
+    test::map_store reader{ reader_configuration };
+    BOOST_REQUIRE(!reader.open(events));
+    BOOST_REQUIRE(&reader.current_prevout() == &reader.prevout);
+    BOOST_REQUIRE(writer.is_prior_readable());
+    BOOST_REQUIRE(!reader.is_prior_readable());
+
+    // Generations are not followed until published and refreshed.
+    BOOST_REQUIRE(!writer.prune(events));
+    writer.set_pool_generation(3);
+    writer.set_validated_tx_generation(5);
+    BOOST_REQUIRE(!reader.refresh(events));
+    BOOST_REQUIRE(&reader.current_prevout() == &reader.prevout);
+    BOOST_REQUIRE_EQUAL(reader.pool_generation(), 0u);
+
+    BOOST_REQUIRE(!writer.publish(events));
+    BOOST_REQUIRE(!reader.refresh(events));
+    BOOST_REQUIRE(&reader.current_prevout() == &reader.prevout1);
+    BOOST_REQUIRE_EQUAL(reader.pool_generation(), 3u);
+    BOOST_REQUIRE_EQUAL(reader.validated_tx_generation(), 5u);
+
+    BOOST_REQUIRE(!reader.close(events));
+    BOOST_REQUIRE(!writer.snapshot(events));
+    BOOST_REQUIRE(!writer.close(events));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(spent_tests)
+
+using namespace system;
+const table::spent::record in1{ {}, 0x81 };
+const table::spent::record in2{ {}, 0x02 };
+const data_chunk expected_head = base16_chunk
+(
+    "00000000" // body count
+    "ffffffff" // incomplete
+);
+const data_chunk closed_head = base16_chunk
+(
+    "02000000" // body count
+    "ffffffff" // incomplete
+);
+const data_chunk expected_body = base16_chunk
+(
+    "81" // outs 0 and 7
+    "02" // outs 9
+);
+
+BOOST_AUTO_TEST_CASE(spent__to_byte__outs__expected)
+{
+    static_assert(table::spent::to_byte(0) == 0u);
+    static_assert(table::spent::to_byte(7) == 0u);
+    static_assert(table::spent::to_byte(8) == 1u);
+    static_assert(table::spent::to_byte(17) == 2u);
+    BOOST_REQUIRE_EQUAL(table::spent::to_byte(0xffffffff), 0x1fffffffu);
+}
+
+BOOST_AUTO_TEST_CASE(spent__to_mask__outs__expected)
+{
+    static_assert(table::spent::to_mask(0) == 0x01u);
+    static_assert(table::spent::to_mask(7) == 0x80u);
+    static_assert(table::spent::to_mask(8) == 0x01u);
+    static_assert(table::spent::to_mask(17) == 0x02u);
+    BOOST_REQUIRE_EQUAL(table::spent::to_mask(9), 0x02u);
+}
+
+BOOST_AUTO_TEST_CASE(spent__put__two__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::spent instance{ head_store, body_store };
+    BOOST_REQUIRE(instance.create());
+
+    table::spent::link link1{};
+    BOOST_REQUIRE(instance.put_link(link1, in1));
+    BOOST_REQUIRE_EQUAL(link1, 0u);
+
+    table::spent::link link2{};
+    BOOST_REQUIRE(instance.put_link(link2, in2));
+    BOOST_REQUIRE_EQUAL(link2, 1u);
+
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+}
+
+BOOST_AUTO_TEST_CASE(spent__set_complete__created__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::spent instance{ head_store, body_store };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(!instance.is_complete());
+
+    BOOST_REQUIRE(instance.set_complete(true));
+    BOOST_REQUIRE(instance.is_complete());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), base16_chunk("0000000000000000"));
+
+    BOOST_REQUIRE(instance.set_complete(false));
+    BOOST_REQUIRE(!instance.is_complete());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+}
+
+BOOST_AUTO_TEST_CASE(spent__get__two__expected)
+{
+    auto head = expected_head;
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::spent instance{ head_store, body_store };
+
+    table::spent::record out{};
+    BOOST_REQUIRE(instance.get(0u, out));
+    BOOST_REQUIRE(out == in1);
+    BOOST_REQUIRE(out.is_spent(0));
+    BOOST_REQUIRE(!out.is_spent(1));
+    BOOST_REQUIRE(out.is_spent(7));
+    BOOST_REQUIRE(instance.get(1u, out));
+    BOOST_REQUIRE(out == in2);
+    BOOST_REQUIRE(!out.is_spent(8));
+    BOOST_REQUIRE(out.is_spent(9));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(subroot_tests)
+
+using namespace system;
+const table::subroot::record node1{ {}, from_uintx(uint256_t(1)) };
+const table::subroot::record node2{ {}, from_uintx(uint256_t(2)) };
+const data_chunk expected_head = base16_chunk
+(
+    "000000"
+);
+const data_chunk closed_head = base16_chunk
+(
+    "020000"
+);
+const data_chunk expected_body = base16_chunk
+(
+    "0100000000000000000000000000000000000000000000000000000000000000"
+    "0200000000000000000000000000000000000000000000000000000000000000"
+);
+
+BOOST_AUTO_TEST_CASE(subroot__to_nodes__leaves__expected)
+{
+    static_assert(table::subroot::to_nodes(0) == 0u);
+    static_assert(table::subroot::to_nodes(1) == 1u);
+    static_assert(table::subroot::to_nodes(2) == 3u);
+    static_assert(table::subroot::to_nodes(3) == 4u);
+    static_assert(table::subroot::to_nodes(4) == 7u);
+    BOOST_REQUIRE_EQUAL(table::subroot::to_nodes(8), 15u);
+}
+
+BOOST_AUTO_TEST_CASE(subroot__to_node__postorder__expected)
+{
+    static_assert(table::subroot::to_node(0, 0) == 0u);
+    static_assert(table::subroot::to_node(0, 1) == 1u);
+    static_assert(table::subroot::to_node(1, 0) == 2u);
+    static_assert(table::subroot::to_node(0, 2) == 3u);
+    static_assert(table::subroot::to_node(0, 3) == 4u);
+    static_assert(table::subroot::to_node(1, 1) == 5u);
+    static_assert(table::subroot::to_node(2, 0) == 6u);
+    BOOST_REQUIRE_EQUAL(table::subroot::to_node(3, 0), 14u);
+}
+
+BOOST_AUTO_TEST_CASE(subroot__put__two__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::subroot instance{ head_store, body_store };
+    BOOST_REQUIRE(instance.create());
+
+    table::subroot::link link1{};
+    BOOST_REQUIRE(instance.put_link(link1, node1));
+    BOOST_REQUIRE_EQUAL(link1, 0u);
+
+    table::subroot::link link2{};
+    BOOST_REQUIRE(instance.put_link(link2, node2));
+    BOOST_REQUIRE_EQUAL(link2, 1u);
+
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+}
+
+BOOST_AUTO_TEST_CASE(subroot__get__two__expected)
+{
+    auto head = expected_head;
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::subroot instance{ head_store, body_store };
+
+    table::subroot::record out{};
+    BOOST_REQUIRE(instance.get(0u, out));
+    BOOST_REQUIRE(out == node1);
+    BOOST_REQUIRE(instance.get(1u, out));
+    BOOST_REQUIRE(out == node2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -28,19 +28,20 @@ const table::address::record in1{ {}, 0x1234567890abcdef };
 const table::address::record in2{ {}, 0xabcdef1234567890 };
 const table::address::record out1{ {}, 0x0000007890abcdef };
 const table::address::record out2{ {}, 0x0000001234567890 };
+// Filter bits (high four bytes of each cell) are set, so all keys screen in.
 const data_chunk expected_head = base16_chunk
 (
-    "00000000"
-    "01000000"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
+    "0000000000000000"
+    "01000000ffffffff"
+    "ffffffffffffffff"
+    "ffffffffffffffff"
+    "ffffffffffffffff"
+    "ffffffffffffffff"
+    "ffffffffffffffff"
+    "ffffffffffffffff"
+    "ffffffffffffffff"
 );
-const data_chunk closed_head = base16_chunk
+const data_chunk legacy_head = base16_chunk
 (
     "02000000"
     "01000000"
@@ -63,6 +64,14 @@ const data_chunk expected_body = base16_chunk
     "9078563412" // output2 [low 5 bytes]
 );
 
+// Head cells carry filter bits above the link, so only links are compared.
+static bool is_bucket(const data_chunk& head, size_t bucket,
+    const data_chunk& link) NOEXCEPT
+{
+    const auto cell = std::next(head.begin(), add1(bucket) * schema::address::cell);
+    return std::equal(link.begin(), link.end(), cell);
+}
+
 BOOST_AUTO_TEST_CASE(address__put__two__expected)
 {
     test::chunk_storage head_store{};
@@ -78,10 +87,15 @@ BOOST_AUTO_TEST_CASE(address__put__two__expected)
     BOOST_REQUIRE(instance.put_link(link2, key2, in2));
     BOOST_REQUIRE_EQUAL(link2, 1u);
 
-    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    const auto& head = head_store.buffer();
+    BOOST_REQUIRE_EQUAL(head.size(), 9u * schema::address::cell);
+    BOOST_REQUIRE(is_bucket(head, 0, base16_chunk("ffffffffffffffff")));
+    BOOST_REQUIRE(is_bucket(head, 1, base16_chunk("01000000")));
+    BOOST_REQUIRE(is_bucket(head, 2, base16_chunk("ffffffffffffffff")));
     BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
     BOOST_REQUIRE(instance.close());
-    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+    BOOST_REQUIRE(std::equal(head.begin(), std::next(head.begin(), 4),
+        base16_chunk("02000000").begin()));
 }
 
 BOOST_AUTO_TEST_CASE(address__get__two__expected)
@@ -101,4 +115,80 @@ BOOST_AUTO_TEST_CASE(address__get__two__expected)
     BOOST_REQUIRE(out == out2);
 }
 
+BOOST_AUTO_TEST_CASE(address__migrate__legacy_head__reindexed)
+{
+    auto head = legacy_head;
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::address instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(!instance.verify());
+    BOOST_REQUIRE(instance.is_legacy(schema::address::legacy_cell));
+    BOOST_REQUIRE(!instance.is_legacy(schema::address::cell));
+
+    BOOST_REQUIRE(instance.migrate(schema::address::legacy_cell));
+    BOOST_REQUIRE(instance.verify());
+    BOOST_REQUIRE(!instance.is_legacy(schema::address::legacy_cell));
+    BOOST_REQUIRE_EQUAL(head_store.buffer().size(), 9u * schema::address::cell);
+    BOOST_REQUIRE(is_bucket(head_store.buffer(), 1, base16_chunk("01000000")));
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+
+    BOOST_REQUIRE_EQUAL(instance.first(key1), 0u);
+    BOOST_REQUIRE_EQUAL(instance.first(key2), 1u);
+    BOOST_REQUIRE(!instance.exists(null_hash));
+
+    // Not legacy, so not migrated.
+    BOOST_REQUIRE(!instance.migrate(schema::address::legacy_cell));
+}
+
+BOOST_AUTO_TEST_CASE(address__migrate__interrupted__resumed)
+{
+    // Migrated head with terminal body count and first of two records indexed.
+    auto head = base16_chunk
+    (
+        "ffffffff00000000"
+        "00000000ffffffff"
+        "ffffffffffffffff"
+        "ffffffffffffffff"
+        "ffffffffffffffff"
+        "ffffffffffffffff"
+        "ffffffffffffffff"
+        "ffffffffffffffff"
+        "ffffffffffffffff"
+    );
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::address instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(!instance.verify());
+    BOOST_REQUIRE(instance.is_legacy(schema::address::legacy_cell));
+
+    BOOST_REQUIRE(instance.migrate(schema::address::legacy_cell));
+    BOOST_REQUIRE(instance.verify());
+    BOOST_REQUIRE(!instance.is_legacy(schema::address::legacy_cell));
+    BOOST_REQUIRE(is_bucket(head_store.buffer(), 1, base16_chunk("01000000")));
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE_EQUAL(instance.first(key1), 0u);
+    BOOST_REQUIRE_EQUAL(instance.first(key2), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(address__sample_filter__two__rejects_probes)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::address instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    size_t rejects{}, probes{};
+    instance.sample_filter(rejects, probes, 8);
+    BOOST_REQUIRE_EQUAL(probes, 0u);
+    BOOST_REQUIRE_EQUAL(rejects, 0u);
+
+    BOOST_REQUIRE(instance.put(key1, in1));
+    BOOST_REQUIRE(instance.put(key2, in2));
+    instance.sample_filter(rejects, probes, 8);
+    BOOST_REQUIRE_EQUAL(probes, 8u);
+    BOOST_REQUIRE(rejects <= probes);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(fee_bk_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(fee_bk__put__get__expected)
+{
+    fee_histogram histogram0{};
+    fee_histogram histogram1{};
+    histogram1.add(0, 100);
+    histogram1.add(1'000, 250);
+    histogram1.add(40'000, 200);
+
+    const table::fee_bk::record put0{ {}, histogram0 };
+    const table::fee_bk::record put1{ {}, histogram1 };
+
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::fee_bk instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(0, put0));
+    BOOST_REQUIRE(instance.put(1, put1));
+    BOOST_REQUIRE_EQUAL(body_store.buffer().size(), 2u * schema::fee_bk::minrow);
+    BOOST_REQUIRE(instance.close());
+
+    table::fee_bk::record get0{};
+    table::fee_bk::record get1{};
+    BOOST_REQUIRE(instance.at(0, get0));
+    BOOST_REQUIRE(instance.at(1, get1));
+    BOOST_REQUIRE(get0 == put0);
+    BOOST_REQUIRE(get1 == put1);
+
+    BOOST_REQUIRE_EQUAL(get1.histogram.fee, 41'000u);
+    BOOST_REQUIRE_EQUAL(get1.histogram.bytes, 550u);
+    BOOST_REQUIRE_EQUAL(get1.histogram.count, 3u);
+    BOOST_REQUIRE_EQUAL(get1.histogram.sizes.at(0), 100u);
+    BOOST_REQUIRE_EQUAL(get1.histogram.sizes.at(4), 250u);
+    BOOST_REQUIRE_EQUAL(get1.histogram.sizes.at(18), 200u);
+}
+
+BOOST_AUTO_TEST_CASE(fee_bk__at__missing__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::fee_bk instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    table::fee_bk::record out{};
+    BOOST_REQUIRE(!instance.at(0, out));
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__to_bin__bounds__expected)
+{
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_bin(0, 0), 0u);
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_bin(99, 100), 0u);
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_bin(100, 100), 1u);
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_bin(700, 100), 6u);
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_bin(800, 100), 7u);
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_bin(50'000, 100), 19u);
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_bin(max_uint64, 1), 19u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/blocks.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(pool_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(pool__put__find__expected)
+{
+    const auto& tx = *test::genesis.transactions_ptr()->front();
+    const auto key = tx.hash(false);
+
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::pool instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(!instance.exists(key));
+    BOOST_REQUIRE(instance.put(key, table::pool::put_ref{ {}, tx }));
+    BOOST_REQUIRE_EQUAL(body_store.buffer().size(), schema::pool::pk +
+        schema::pool::sk + tx.serialized_size(true));
+
+    table::pool::get_tx out{};
+    BOOST_REQUIRE(instance.find(key, out));
+    BOOST_REQUIRE(out.tx);
+    BOOST_REQUIRE(*out.tx == tx);
+    BOOST_REQUIRE(!instance.find(null_hash, out));
+}
+
+BOOST_AUTO_TEST_CASE(pool__reset__populated__empty)
+{
+    const auto& tx = *test::genesis.transactions_ptr()->front();
+    const auto key = tx.hash(false);
+
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::pool instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(key, table::pool::put_ref{ {}, tx }));
+
+    const auto head = head_store.buffer();
+    BOOST_REQUIRE(instance.reset());
+    BOOST_REQUIRE(!instance.exists(key));
+    BOOST_REQUIRE(body_store.buffer().empty());
+    BOOST_REQUIRE_EQUAL(head_store.buffer().size(), head.size());
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 8u);
+    BOOST_REQUIRE(instance.verify());
+
+    BOOST_REQUIRE(instance.put(key, table::pool::put_ref{ {}, tx }));
+    BOOST_REQUIRE(instance.exists(key));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(hash_bloom_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(hash_bloom__enabled__below_block__false)
+{
+    const hash_bloom instance{ 63 };
+    BOOST_REQUIRE(!instance.enabled());
+    BOOST_REQUIRE(!instance.loaded());
+    BOOST_REQUIRE(instance.contains(null_hash));
+}
+
+BOOST_AUTO_TEST_CASE(hash_bloom__contains__disabled_loaded__true)
+{
+    hash_bloom instance{ 0 };
+    instance.load();
+    BOOST_REQUIRE(instance.loaded());
+    BOOST_REQUIRE(instance.contains(one_hash));
+}
+
+BOOST_AUTO_TEST_CASE(hash_bloom__contains__unloaded__true)
+{
+    const hash_bloom instance{ 1024 };
+    BOOST_REQUIRE(instance.enabled());
+    BOOST_REQUIRE(!instance.loaded());
+    BOOST_REQUIRE(instance.contains(one_hash));
+}
+
+BOOST_AUTO_TEST_CASE(hash_bloom__contains__loaded__expected)
+{
+    hash_bloom instance{ 1024 };
+    instance.load();
+    BOOST_REQUIRE(!instance.contains(one_hash));
+
+    instance.insert(one_hash);
+    BOOST_REQUIRE(instance.contains(one_hash));
+    BOOST_REQUIRE(!instance.contains(sha256_hash(one_hash)));
+}
+
+BOOST_AUTO_TEST_CASE(hash_bloom__insert__many__no_false_negatives)
+{
+    hash_bloom instance{ 4096 };
+    instance.load();
+
+    hashes keys{};
+    auto key = null_hash;
+    for (size_t index = 0; index < 100; ++index)
+        keys.push_back((key = sha256_hash(key)));
+
+    for (const auto& value: keys)
+        instance.insert(value);
+
+    for (const auto& value: keys)
+        BOOST_REQUIRE(instance.contains(value));
+}
+
+BOOST_AUTO_TEST_CASE(hash_bloom__unload__loaded__cleared)
+{
+    hash_bloom instance{ 1024 };
+    instance.load();
+    instance.insert(one_hash);
+    instance.unload();
+    BOOST_REQUIRE(!instance.loaded());
+    BOOST_REQUIRE(instance.contains(null_hash));
+
+    instance.load();
+    BOOST_REQUIRE(!instance.contains(one_hash));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(short_ids_tests)
+
+using namespace system;
+
+// SipHash-2-4 reference key (00..0f).
+constexpr short_ids::key reference_key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+
+BOOST_AUTO_TEST_CASE(short_ids__siphash__reference_vectors__expected)
+{
+    BOOST_REQUIRE_EQUAL(short_ids::siphash(reference_key, {}), 0x726fdb47dd0e0e31u);
+    BOOST_REQUIRE_EQUAL(short_ids::siphash(reference_key, base16_chunk("000102030405060708090a0b0c0d0e")), 0xa129ca6149be45e5u);
+}
+
+BOOST_AUTO_TEST_CASE(short_ids__to_id__hash__six_bytes)
+{
+    const auto hash = base16_hash("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+    BOOST_REQUIRE_EQUAL(short_ids::siphash(reference_key, hash), 0x7127512f72f27cceu);
+    BOOST_REQUIRE_EQUAL(short_ids::to_id(reference_key, hash), 0x512f72f27cceu);
+}
+
+BOOST_AUTO_TEST_CASE(short_ids__to_key__header_nonce__expected)
+{
+    const auto key = short_ids::to_key(data_chunk(80, 0x00), 1);
+    BOOST_REQUIRE_EQUAL(key.k0, 0xae0ad3c3b5097334u);
+    BOOST_REQUIRE_EQUAL(key.k1, 0xac12fdc323aab55du);
+}
+
+BOOST_AUTO_TEST_CASE(short_ids__find__collision__all)
+{
+    const short_ids::map map{ { 1, 10 }, { 2, 20 }, { 2, 21 }, { 3, 30 } };
+    BOOST_REQUIRE(short_ids::find(map, 0).empty());
+    BOOST_REQUIRE_EQUAL(short_ids::find(map, 1).size(), 1u);
+    BOOST_REQUIRE_EQUAL(short_ids::find(map, 2).size(), 2u);
+    BOOST_REQUIRE_EQUAL(short_ids::find(map, 2).back(), 21u);
+    BOOST_REQUIRE(short_ids::find(map, 4).empty());
+}
+
+BOOST_AUTO_TEST_CASE(short_ids__push__disabled__empty)
+{
+    short_ids instance{ 0 };
+    BOOST_REQUIRE(!instance.enabled());
+
+    instance.push(1, one_hash);
+    short_ids::entries out{};
+    BOOST_REQUIRE_EQUAL(instance.snapshot(out), 0u);
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(short_ids__push__full__overwrites_oldest)
+{
+    short_ids instance{ 2 };
+    instance.push(1, one_hash);
+    instance.push(2, one_hash);
+    instance.push(3, one_hash);
+
+    short_ids::entries out{};
+    BOOST_REQUIRE_EQUAL(instance.snapshot(out), 3u);
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out.front().link, 3u);
+    BOOST_REQUIRE_EQUAL(out.back().link, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(short_ids__get__pushed__retained_with_sequence)
+{
+    short_ids instance{ 4 };
+    instance.push(1, one_hash);
+
+    short_ids::entries out{};
+    const auto sequence = instance.snapshot(out);
+    const auto map = std::make_shared<const short_ids::map>();
+    instance.put(reference_key, sequence, map);
+
+    size_t cached{};
+    BOOST_REQUIRE(instance.get(reference_key, cached) == map);
+    BOOST_REQUIRE_EQUAL(cached, sequence);
+    BOOST_REQUIRE(!instance.get({ 1, 2 }, cached));
+
+    // Push does not invalidate the map, its sequence identifies the delta.
+    instance.push(2, one_hash);
+    BOOST_REQUIRE(instance.get(reference_key, cached) == map);
+    BOOST_REQUIRE_EQUAL(cached, sequence);
+
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.snapshot(out), 0u);
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(short_ids__since__pushed__delta)
+{
+    short_ids instance{ 2 };
+    instance.push(1, one_hash);
+
+    size_t sequence{ 1 };
+    short_ids::entries out{};
+    BOOST_REQUIRE(instance.since(out, sequence));
+    BOOST_REQUIRE(out.empty());
+
+    instance.push(2, one_hash);
+    instance.push(3, one_hash);
+    BOOST_REQUIRE(instance.since(out, sequence));
+    BOOST_REQUIRE_EQUAL(sequence, 3u);
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out.front().link, 2u);
+    BOOST_REQUIRE_EQUAL(out.back().link, 3u);
+
+    // The first push has been overwritten (capacity two).
+    out.clear();
+    sequence = 0;
+    BOOST_REQUIRE(!instance.since(out, sequence));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(wire_cache_tests)
+
+using namespace system;
+using kind = wire_cache::kind;
+
+BOOST_AUTO_TEST_CASE(wire_cache__enabled__zero_capacity__false)
+{
+    const wire_cache instance{ 0 };
+    BOOST_REQUIRE(!instance.enabled());
+    BOOST_REQUIRE(!instance.get(42, kind::block));
+}
+
+BOOST_AUTO_TEST_CASE(wire_cache__get__put__hit)
+{
+    wire_cache instance{ 16 * 1024 };
+    const auto data = to_shared<const data_chunk>(data_chunk{ 0x01, 0x02 });
+    BOOST_REQUIRE(instance.enabled());
+    BOOST_REQUIRE(!instance.get(42, kind::block));
+
+    instance.put(42, kind::block, data);
+    BOOST_REQUIRE(instance.get(42, kind::block) == data);
+    BOOST_REQUIRE(!instance.get(42, kind::witness_block));
+    BOOST_REQUIRE(!instance.get(42, kind::header));
+
+    const auto metrics = instance.get_metrics();
+    BOOST_REQUIRE_EQUAL(metrics.hits, 1u);
+    BOOST_REQUIRE_EQUAL(metrics.misses, 3u);
+    BOOST_REQUIRE_EQUAL(metrics.entries, 1u);
+    BOOST_REQUIRE_EQUAL(metrics.bytes, 2u + wire_cache::overhead());
+}
+
+BOOST_AUTO_TEST_CASE(wire_cache__put__over_budget__evicts_least_recent)
+{
+    // 16 shards of two entries, links 0/16/32 share shard zero.
+    constexpr auto entry = 2u + wire_cache::overhead();
+    wire_cache instance{ 16 * 2 * entry };
+    const auto one = to_shared<const data_chunk>(data_chunk{ 0x01, 0x01 });
+    const auto two = to_shared<const data_chunk>(data_chunk{ 0x02, 0x02 });
+    const auto three = to_shared<const data_chunk>(data_chunk{ 0x03, 0x03 });
+    instance.put(0, kind::block, one);
+    instance.put(16, kind::block, two);
+
+    // Promote zero, so sixteen is least recently used.
+    BOOST_REQUIRE(instance.get(0, kind::block));
+    instance.put(32, kind::block, three);
+    BOOST_REQUIRE(instance.get(0, kind::block) == one);
+    BOOST_REQUIRE(!instance.get(16, kind::block));
+    BOOST_REQUIRE(instance.get(32, kind::block) == three);
+    BOOST_REQUIRE_EQUAL(instance.get_metrics().bytes, 2 * entry);
+}
+
+BOOST_AUTO_TEST_CASE(wire_cache__put__exceeds_shard__not_cached)
+{
+    wire_cache instance{ 16 };
+    const auto data = to_shared<const data_chunk>(data_chunk{ 0x01, 0x02 });
+    instance.put(1, kind::header, data);
+    BOOST_REQUIRE(!instance.get(1, kind::header));
+    BOOST_REQUIRE_EQUAL(instance.get_metrics().entries, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(wire_cache__put__overhead_exceeds_shard__not_cached)
+{
+    // Payload fits the shard budget, but payload with overhead does not.
+    wire_cache instance{ 16 * (2u + wire_cache::overhead() - 1u) };
+    const auto data = to_shared<const data_chunk>(data_chunk{ 0x01, 0x02 });
+    instance.put(1, kind::header, data);
+    BOOST_REQUIRE(!instance.get(1, kind::header));
+    BOOST_REQUIRE_EQUAL(instance.get_metrics().entries, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(wire_cache__erase__all_kinds__removed)
+{
+    wire_cache instance{ 16 * 1024 };
+    const auto data = to_shared<const data_chunk>(data_chunk{ 0x01 });
+    instance.put(7, kind::header, data);
+    instance.put(7, kind::block, data);
+    instance.put(7, kind::witness_block, data);
+    instance.put(8, kind::block, data);
+    instance.erase(7);
+    BOOST_REQUIRE(!instance.get(7, kind::header));
+    BOOST_REQUIRE(!instance.get(7, kind::block));
+    BOOST_REQUIRE(!instance.get(7, kind::witness_block));
+    BOOST_REQUIRE(instance.get(8, kind::block));
+
+    instance.clear();
+    BOOST_REQUIRE(!instance.get(8, kind::block));
+    BOOST_REQUIRE_EQUAL(instance.get_metrics().bytes, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
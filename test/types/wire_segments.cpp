@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(wire_segments_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(wire_segments__size__default__zero)
+{
+    const wire_segments instance{};
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(instance.to_chunk().empty());
+}
+
+BOOST_AUTO_TEST_CASE(wire_segments__to_chunk__segments__concatenated)
+{
+    const data_chunk mapped{ 0x01, 0x02, 0x03 };
+    wire_segments instance{};
+    instance.scratch = { 0xaa, 0xbb };
+    instance.segments.push_back({ instance.scratch.data(), 1 });
+    instance.segments.push_back({ mapped.data(), mapped.size() });
+    instance.segments.push_back({ std::next(instance.scratch.data()), 1 });
+    BOOST_REQUIRE_EQUAL(instance.size(), 5u);
+    BOOST_REQUIRE_EQUAL(instance.to_chunk(), base16_chunk("aa010203bb"));
+}
+
+BOOST_AUTO_TEST_CASE(wire_segments__reset__populated__empty)
+{
+    wire_segments instance{};
+    instance.scratch = { 0xaa };
+    instance.segments.push_back({ instance.scratch.data(), 1 });
+    instance.reset();
+    BOOST_REQUIRE(instance.segments.empty());
+    BOOST_REQUIRE(instance.scratch.empty());
+    BOOST_REQUIRE(instance.guards.empty());
+}
+
+BOOST_AUTO_TEST_CASE(wire_segments__move__populated__segments_retained)
+{
+    static_assert(!std::is_copy_constructible_v<wire_segments>);
+    static_assert(!std::is_copy_assignable_v<wire_segments>);
+
+    wire_segments instance{};
+    instance.scratch = { 0xaa, 0xbb };
+    instance.segments.push_back({ instance.scratch.data(), 2 });
+    const wire_segments moved{ std::move(instance) };
+    BOOST_REQUIRE(moved.segments.front().data == moved.scratch.data());
+    BOOST_REQUIRE_EQUAL(moved.to_chunk(), base16_chunk("aabb"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()